@@ -0,0 +1,97 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include <QtTest>
+#include "throughputbenchmark.h"
+#include "latencybenchmark.h"
+#include "idlebenchmark.h"
+#include "startupbenchmark.h"
+#include "axisfilterbenchmark.h"
+#include "eventdispatchbenchmark.h"
+
+#include <SDL3/SDL_hints.h>
+
+// Use This macros for initialize your own benchmark classes.
+#define TestCase(name, testClass) \
+    void name() { \
+        initTest(new testClass()); \
+    }
+
+/**
+ * @brief The tstBenchmarks class - this is main benchmark class
+ */
+class tstBenchmarks : public QObject
+{
+    Q_OBJECT
+
+
+public:
+    tstBenchmarks();
+
+    ~tstBenchmarks();
+
+private slots:
+
+
+    // BEGIN TESTS CASES
+    TestCase(throughputBenchmark, ThroughputBenchmark)
+    TestCase(latencyBenchmark, LatencyBenchmark)
+    TestCase(idleBenchmark, IdleBenchmark)
+    TestCase(startupBenchmark, StartupBenchmark)
+    TestCase(axisFilterBenchmark, AxisFilterBenchmark)
+    TestCase(axisFilterScalarBenchmark, AxisFilterScalarBenchmark)
+    TestCase(eventDispatchBenchmark, EventDispatchBenchmark)
+    TestCase(eventSwitchDispatchBenchmark, EventSwitchDispatchBenchmark)
+    // END TEST CASES
+
+private:
+
+    /**
+     * @brief initTest This method prepare @a test for run in the QApplication loop.
+     * @param test are input test case class.
+     */
+    void initTest(testcore::ITest* test);
+
+    QCoreApplication *_app = nullptr;
+};
+
+/**
+ * @brief tstBenchmarks::tstBenchmarks
+ * init all availabel benchmarks
+ */
+tstBenchmarks::tstBenchmarks() {
+
+    int argc =0;
+    char * argv[] = {nullptr};
+
+    _app = new QCoreApplication(argc, argv);
+    QCoreApplication::setApplicationName("benchQtSDL");
+    QCoreApplication::setOrganizationName("QuasarApp");
+
+    // Run headless: no window is created, and the virtual joysticks report input without focus.
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS, "1");
+}
+
+tstBenchmarks::~tstBenchmarks() {
+    _app->exit(0);
+    delete _app;
+}
+
+void tstBenchmarks::initTest(testcore::ITest *test) {
+    QTimer::singleShot(0, this, [this, test]() {
+        test->test();
+        delete test;
+        _app->exit(0);
+    });
+
+    _app->exec();
+}
+
+QTEST_APPLESS_MAIN(tstBenchmarks)
+
+#include "tstBenchmarks.moc"
@@ -0,0 +1,34 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+/**
+ * @brief The AllocationCounter class counts the heap allocations of the whole benchmark process.
+ *
+ * The benchmark executable replaces the global `operator new`, so allocations made by Qt,
+ * by the library and by the benchmarks are all counted, on every thread.
+ */
+class AllocationCounter
+{
+public:
+    /**
+     * @brief Returns the number of allocations since the last `reset()`.
+     */
+    static quint64 count();
+
+    /**
+     * @brief Resets the allocation counter.
+     */
+    static void reset();
+};
+
+#endif // ALLOCATIONCOUNTER_H
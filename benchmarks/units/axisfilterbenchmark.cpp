@@ -0,0 +1,64 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "axisfilterbenchmark.h"
+
+#include <QtSDL/gamepadaxisfilter.h>
+
+#include <QRandomGenerator>
+
+using QtSDL::GamepadAxisFilter;
+
+namespace {
+
+/**
+ * @brief The number of samples transformed in one iteration.
+ */
+constexpr qsizetype SAMPLES = 4096;
+}
+
+AxisFilterBenchmark::AxisFilterBenchmark(bool scalar):
+    _scalar(scalar) {
+
+}
+
+AxisFilterBenchmark::~AxisFilterBenchmark() {
+
+}
+
+void AxisFilterBenchmark::test() {
+    QList<qint16> x, y;
+    QList<float> deadzone, invRange, curve;
+
+    QRandomGenerator random(0x51D1);
+    for (qsizetype i = 0; i < SAMPLES; ++i) {
+        GamepadAxisFilter::Settings settings;
+        settings.deadzone = random.bounded(0.3);
+        settings.curve = random.bounded(1.0);
+        const auto params = GamepadAxisFilter::Params::fromSettings(settings);
+
+        x.append(static_cast<qint16>(random.bounded(-32768, 32768)));
+        y.append(static_cast<qint16>(random.bounded(-32768, 32768)));
+        deadzone.append(params.deadzone);
+        invRange.append(params.invRange);
+        curve.append(params.curve);
+    }
+
+    QList<float> out(SAMPLES);
+    const auto transform = (_scalar)? &GamepadAxisFilter::transformScalar: &GamepadAxisFilter::transform;
+
+    QBENCHMARK {
+        transform(x.constData(), y.constData(), deadzone.constData(), invRange.constData(), curve.constData(),
+                  out.data(), SAMPLES);
+    }
+}
+
+AxisFilterScalarBenchmark::AxisFilterScalarBenchmark():
+    AxisFilterBenchmark(true) {
+
+}
@@ -0,0 +1,45 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef AXISFILTERBENCHMARK_H
+#define AXISFILTERBENCHMARK_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The AxisFilterBenchmark class measures the SIMD transform of `GamepadAxisFilter` on a block of samples.
+ */
+class AxisFilterBenchmark: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    /**
+     * @brief Constructs the benchmark.
+     * @param scalar true to measure the scalar reference transform instead of the SIMD one.
+     */
+    explicit AxisFilterBenchmark(bool scalar = false);
+    ~AxisFilterBenchmark();
+
+    void test();
+
+private:
+    bool _scalar;
+};
+
+/**
+ * @brief The AxisFilterScalarBenchmark class measures the scalar reference transform of `GamepadAxisFilter`.
+ */
+class AxisFilterScalarBenchmark: public AxisFilterBenchmark
+{
+public:
+    AxisFilterScalarBenchmark();
+};
+
+#endif // AXISFILTERBENCHMARK_H
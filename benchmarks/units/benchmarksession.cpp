@@ -0,0 +1,59 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "benchmarksession.h"
+
+#include <QtSDL.h>
+
+BenchmarkSession::BenchmarkSession(qsizetype latencyCapacity): _probe(latencyCapacity) {
+
+}
+
+BenchmarkSession::~BenchmarkSession() {
+    // The virtual joystick must be detached before the manager shuts SDL down.
+    _gamepad.detach();
+    _manager.reset();
+}
+
+bool BenchmarkSession::start() {
+    if (!QtSDL::init()) {
+        return false;
+    }
+
+    _manager = std::make_unique<QtSDL::SDLEventManager>();
+    _manager->subscribe(&_probe);
+
+    if (!_gamepad.attach()) {
+        return false;
+    }
+
+    _manager->start();
+    return wait([this]() { return _probe.addedDevices() > 0; }, 5000);
+}
+
+const char *BenchmarkSession::waitModeName(QtSDL::SDLEventManager::WaitMode mode) {
+    switch (mode) {
+    case QtSDL::SDLEventManager::WaitMode::Poll: return "poll";
+    case QtSDL::SDLEventManager::WaitMode::Wait: return "wait";
+    case QtSDL::SDLEventManager::WaitMode::Adaptive: return "adaptive";
+    }
+
+    return "unknown";
+}
+
+QtSDL::SDLEventManager &BenchmarkSession::manager() {
+    return *_manager;
+}
+
+EventProbe &BenchmarkSession::probe() {
+    return _probe;
+}
+
+VirtualGamepad &BenchmarkSession::gamepad() {
+    return _gamepad;
+}
@@ -0,0 +1,54 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef BENCHMARKSESSION_H
+#define BENCHMARKSESSION_H
+
+#include "eventprobe.h"
+#include "virtualgamepad.h"
+#include "testcore/testutils.h"
+
+#include <QtSDL/sdleventmanager.h>
+#include <memory>
+
+/**
+ * @brief The BenchmarkSession class initializes SDL, attaches a virtual gamepad and runs
+ *  an `SDLEventManager` that delivers all its events to an `EventProbe`.
+ */
+class BenchmarkSession: public testcore::TestUtils
+{
+public:
+    /**
+     * @brief Constructs a session.
+     * @param latencyCapacity The number of latency samples the probe can record.
+     */
+    explicit BenchmarkSession(qsizetype latencyCapacity = 0);
+    ~BenchmarkSession();
+
+    /**
+     * @brief Starts the manager and waits until it delivers the connection of the virtual gamepad.
+     * @return true if the session is ready.
+     */
+    bool start();
+
+    /**
+     * @brief Returns the name of a wait mode for the benchmark reports.
+     */
+    static const char* waitModeName(QtSDL::SDLEventManager::WaitMode mode);
+
+    QtSDL::SDLEventManager& manager();
+    EventProbe& probe();
+    VirtualGamepad& gamepad();
+
+private:
+    EventProbe _probe;
+    std::unique_ptr<QtSDL::SDLEventManager> _manager;
+    VirtualGamepad _gamepad;
+};
+
+#endif // BENCHMARKSESSION_H
@@ -0,0 +1,88 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "eventdispatchbenchmark.h"
+
+#include <QtSDL/qsdleventfactory.h>
+#include <QtSDL/qsdlgamepadaxisevent.h>
+#include <QtSDL/qsdlgamepadbuttonevent.h>
+#include <QtSDL/qsdlgamepadevent.h>
+#include <QtSDL/qsdlgamepadsensorevent.h>
+#include <QtSDL/qsdlgamepadtouchpadevent.h>
+
+namespace {
+
+// The switch used by SDLEventManager before the factory table.
+QtSDL::QSDLEvent* switchWrap(const SDL_Event& event) {
+    auto type = static_cast<SDL_EventType>(event.type);
+
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_ADDED:
+    case SDL_EVENT_GAMEPAD_REMOVED:
+    case SDL_EVENT_GAMEPAD_REMAPPED:
+    case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:
+    case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED:
+        return new QtSDL::QSDLGamepadEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:
+        return new QtSDL::QSDLGamepadTouchpadEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        return new QtSDL::QSDLGamepadSensorEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+    case SDL_EVENT_GAMEPAD_BUTTON_UP:
+        return new QtSDL::QSDLGamepadButtonEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        return new QtSDL::QSDLGamepadAxisEvent(event, type);
+
+    default:
+        return new QtSDL::QSDLEvent(event, type);
+    }
+}
+}
+
+EventDispatchBenchmark::EventDispatchBenchmark(bool useSwitch):
+    _useSwitch(useSwitch) {
+
+}
+
+EventDispatchBenchmark::~EventDispatchBenchmark() {
+
+}
+
+void EventDispatchBenchmark::test() {
+    QList<SDL_Event> events;
+    for (Uint32 type = SDL_EVENT_GAMEPAD_AXIS_MOTION; type <= SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED; ++type) {
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = type;
+        events.append(event);
+    }
+
+    const auto wrap = (_useSwitch)? &switchWrap: &QtSDL::QSDLEventFactory::create;
+
+    // Warm up the event pool, so all iterations allocate from the free list.
+    for (const SDL_Event& event : std::as_const(events)) {
+        delete wrap(event);
+    }
+
+    QBENCHMARK {
+        for (const SDL_Event& event : std::as_const(events)) {
+            delete wrap(event);
+        }
+    }
+}
+
+EventSwitchDispatchBenchmark::EventSwitchDispatchBenchmark():
+    EventDispatchBenchmark(true) {
+
+}
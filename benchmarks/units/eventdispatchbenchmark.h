@@ -0,0 +1,45 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef EVENTDISPATCHBENCHMARK_H
+#define EVENTDISPATCHBENCHMARK_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The EventDispatchBenchmark class measures how fast `QSDLEventFactory` wraps one event of each gamepad type.
+ */
+class EventDispatchBenchmark: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    /**
+     * @brief Constructs the benchmark.
+     * @param useSwitch true to measure the switch the factory table replaced.
+     */
+    explicit EventDispatchBenchmark(bool useSwitch = false);
+    ~EventDispatchBenchmark();
+
+    void test();
+
+private:
+    bool _useSwitch;
+};
+
+/**
+ * @brief The EventSwitchDispatchBenchmark class measures the switch that `QSDLEventFactory` replaced.
+ */
+class EventSwitchDispatchBenchmark: public EventDispatchBenchmark
+{
+public:
+    EventSwitchDispatchBenchmark();
+};
+
+#endif // EVENTDISPATCHBENCHMARK_H
@@ -0,0 +1,94 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "eventprobe.h"
+
+#include <QtSDL/qsdlevent.h>
+#include <QtSDL/qsdleventbatch.h>
+
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
+
+using QtSDL::QSDLEvent;
+using QtSDL::QSDLEventBatch;
+
+EventProbe::EventProbe(qsizetype latencyCapacity) {
+    _latencies.reserve(latencyCapacity);
+}
+
+bool EventProbe::event(QEvent *event) {
+    const auto type = static_cast<int>(event->type());
+
+    if (type == QSDLEvent::SDLType) {
+        handle(static_cast<QSDLEvent*>(event)->data(), SDL_GetTicksNS());
+        return true;
+    }
+
+    if (type == QSDLEvent::SDLBatchType) {
+        const Uint64 now = SDL_GetTicksNS();
+        for (const SDL_Event& sdlEvent: *static_cast<QSDLEventBatch*>(event)) {
+            handle(sdlEvent, now);
+        }
+        return true;
+    }
+
+    return QObject::event(event);
+}
+
+void EventProbe::handle(const SDL_Event &event, Uint64 now) {
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_ADDED:
+        ++_addedDevices;
+        return;
+
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+    case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+    case SDL_EVENT_GAMEPAD_BUTTON_UP:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        ++_inputEvents;
+        if (_latencies.size() < _latencies.capacity()) {
+            _latencies.append((now > event.common.timestamp)? now - event.common.timestamp: 0);
+        }
+        return;
+
+    default:
+        return;
+    }
+}
+
+qint64 EventProbe::inputEvents() const {
+    return _inputEvents;
+}
+
+qint64 EventProbe::addedDevices() const {
+    return _addedDevices;
+}
+
+EventProbe::Percentiles EventProbe::percentiles() const {
+    Percentiles result;
+    if (_latencies.isEmpty()) {
+        return result;
+    }
+
+    QList<Uint64> sorted = _latencies;
+    std::sort(sorted.begin(), sorted.end());
+
+    result.p50 = sorted[sorted.size() / 2];
+    result.p99 = sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+    result.max = sorted.last();
+    return result;
+}
+
+void EventProbe::reset() {
+    _inputEvents = 0;
+    _addedDevices = 0;
+    _latencies.clear();
+}
@@ -0,0 +1,70 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef EVENTPROBE_H
+#define EVENTPROBE_H
+
+#include <QObject>
+#include <QList>
+#include <SDL3/SDL_events.h>
+
+/**
+ * @brief The EventProbe class receives the events of `SDLEventManager` and measures their delivery latency.
+ *
+ * The latency of an event is the time between its SDL timestamp and the moment Qt calls `event()`.
+ * Both single `QSDLEvent` and `QSDLEventBatch` deliveries are handled.
+ */
+class EventProbe: public QObject
+{
+public:
+    /**
+     * @brief The Percentiles struct contains the latency distribution in nanoseconds.
+     */
+    struct Percentiles {
+        Uint64 p50 = 0;
+        Uint64 p99 = 0;
+        Uint64 max = 0;
+    };
+
+    /**
+     * @brief Constructs a probe.
+     * @param latencyCapacity The number of latency samples reserved up front, so recording does not allocate.
+     */
+    explicit EventProbe(qsizetype latencyCapacity = 0);
+
+    bool event(QEvent* event) override;
+
+    /**
+     * @brief Returns the number of received input events (axes, buttons, touchpads and sensors).
+     */
+    qint64 inputEvents() const;
+
+    /**
+     * @brief Returns the number of received gamepad connection events.
+     */
+    qint64 addedDevices() const;
+
+    /**
+     * @brief Returns the latency distribution of the received input events.
+     */
+    Percentiles percentiles() const;
+
+    /**
+     * @brief Drops all counters and latency samples.
+     */
+    void reset();
+
+private:
+    void handle(const SDL_Event& event, Uint64 now);
+
+    qint64 _inputEvents = 0;
+    qint64 _addedDevices = 0;
+    QList<Uint64> _latencies;
+};
+
+#endif // EVENTPROBE_H
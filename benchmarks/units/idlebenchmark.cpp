@@ -0,0 +1,64 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "idlebenchmark.h"
+#include "benchmarksession.h"
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <ctime>
+
+using QtSDL::SDLEventManager;
+
+namespace {
+
+/**
+ * @brief The duration of one measurement in milliseconds.
+ */
+constexpr int IDLE_DURATION = 1000;
+
+/**
+ * @brief The CPU usage, in percent of one core, above which the wait mode is considered busy waiting.
+ */
+constexpr double MAX_WAIT_MODE_CPU = 25.0;
+}
+
+IdleBenchmark::IdleBenchmark() {
+
+}
+
+IdleBenchmark::~IdleBenchmark() {
+
+}
+
+void IdleBenchmark::test() {
+    BenchmarkSession session;
+    QVERIFY(session.start());
+
+    const SDLEventManager::WaitMode modes[] = {SDLEventManager::WaitMode::Poll,
+                                               SDLEventManager::WaitMode::Wait,
+                                               SDLEventManager::WaitMode::Adaptive};
+    for (auto mode: modes) {
+        session.manager().setWaitMode(mode);
+        wait([]() { return false; }, 200);
+
+        // The main thread sleeps, so the process CPU time is spent by the manager thread.
+        QElapsedTimer timer;
+        timer.start();
+        const std::clock_t cpuStart = std::clock();
+        QThread::msleep(IDLE_DURATION);
+        const double cpu = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        const double usage = cpu * 1e9 / timer.nsecsElapsed() * 100.0;
+
+        qInfo().nospace() << "IdleBenchmark: " << BenchmarkSession::waitModeName(mode) << " mode, idle CPU " << usage << " % of one core";
+
+        if (mode == SDLEventManager::WaitMode::Wait) {
+            QVERIFY(usage < MAX_WAIT_MODE_CPU);
+        }
+    }
+}
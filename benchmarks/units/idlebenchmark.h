@@ -0,0 +1,29 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef IDLEBENCHMARK_H
+#define IDLEBENCHMARK_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The IdleBenchmark class measures the CPU used by `SDLEventManager` while no input arrives.
+ */
+class IdleBenchmark: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    IdleBenchmark();
+    ~IdleBenchmark();
+
+    void test();
+};
+
+#endif // IDLEBENCHMARK_H
@@ -0,0 +1,107 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "latencybenchmark.h"
+#include "benchmarksession.h"
+
+#include <QThread>
+#include <SDL3/SDL_gamepad.h>
+#include <SDL3/SDL_timer.h>
+#include <cmath>
+#include <memory>
+
+using QtSDL::SDLEventManager;
+
+namespace {
+
+/**
+ * @brief The rate at which the virtual gamepad is driven, in updates per second.
+ */
+constexpr Uint64 DRIVE_RATE = 1000;
+
+/**
+ * @brief The duration of one measurement in milliseconds.
+ */
+constexpr Uint64 DRIVE_DURATION = 1000;
+
+/**
+ * @brief Changes the axes, buttons, touchpad and gyroscope of the gamepad at `DRIVE_RATE`.
+ */
+void drive(VirtualGamepad& gamepad) {
+    const Uint64 interval = SDL_NS_PER_SECOND / DRIVE_RATE;
+    const Uint64 ticks = DRIVE_RATE * DRIVE_DURATION / 1000;
+    Uint64 due = SDL_GetTicksNS();
+
+    for (Uint64 tick = 0; tick < ticks; ++tick) {
+        const float phase = static_cast<float>(tick) / DRIVE_RATE * 6.2831853f;
+
+        gamepad.setAxis(SDL_GAMEPAD_AXIS_LEFTX, static_cast<Sint16>(std::sin(phase) * 32767));
+        gamepad.setAxis(SDL_GAMEPAD_AXIS_LEFTY, static_cast<Sint16>(std::cos(phase) * 32767));
+
+        if (tick % 8 == 0) {
+            gamepad.setButton(SDL_GAMEPAD_BUTTON_SOUTH, (tick / 8) % 2 == 0);
+        }
+
+        gamepad.setTouchpad(0, true, 0.5f + std::sin(phase) * 0.4f, 0.5f);
+
+        const float gyro[3] = {std::sin(phase), std::cos(phase), 0.0f};
+        gamepad.sendSensor(SDL_SENSOR_GYRO, due, gyro);
+
+        due += interval;
+        const Uint64 now = SDL_GetTicksNS();
+        if (due > now) {
+            SDL_DelayPrecise(due - now);
+        }
+    }
+
+    gamepad.setTouchpad(0, false, 0.5f, 0.5f);
+}
+}
+
+LatencyBenchmark::LatencyBenchmark() {
+
+}
+
+LatencyBenchmark::~LatencyBenchmark() {
+
+}
+
+void LatencyBenchmark::test() {
+    // Each tick produces up to six events: two axes, a button, a touchpad motion and a gyroscope sample.
+    BenchmarkSession session(DRIVE_RATE * DRIVE_DURATION / 1000 * 6);
+    QVERIFY(session.start());
+
+    EventProbe& probe = session.probe();
+    VirtualGamepad& gamepad = session.gamepad();
+
+    // The manager does not enable gamepad sensors by itself.
+    session.manager().requestSensor(SDL_SENSOR_GYRO);
+
+    const SDLEventManager::WaitMode modes[] = {SDLEventManager::WaitMode::Poll,
+                                               SDLEventManager::WaitMode::Wait,
+                                               SDLEventManager::WaitMode::Adaptive};
+    for (auto mode: modes) {
+        session.manager().setWaitMode(mode);
+        wait([]() { return false; }, 100);
+        probe.reset();
+
+        std::unique_ptr<QThread> driver(QThread::create(drive, std::ref(gamepad)));
+        driver->start();
+        QVERIFY(wait([&driver]() { return driver->isFinished(); }, DRIVE_DURATION * 10));
+
+        // Let the manager deliver the last events.
+        wait([]() { return false; }, 100);
+        QVERIFY(probe.inputEvents() > 0);
+
+        const auto latency = probe.percentiles();
+        qInfo().nospace() << "LatencyBenchmark: " << BenchmarkSession::waitModeName(mode) << " mode, "
+                          << probe.inputEvents() << " events, latency p50 " << latency.p50 / 1000.0
+                          << " us, p99 " << latency.p99 / 1000.0
+                          << " us, max " << latency.max / 1000.0 << " us";
+    }
+}
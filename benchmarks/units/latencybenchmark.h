@@ -0,0 +1,29 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef LATENCYBENCHMARK_H
+#define LATENCYBENCHMARK_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The LatencyBenchmark class measures the latency from the SDL timestamp to the Qt `event()` call while a virtual gamepad is driven at a fixed rate.
+ */
+class LatencyBenchmark: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    LatencyBenchmark();
+    ~LatencyBenchmark();
+
+    void test();
+};
+
+#endif // LATENCYBENCHMARK_H
@@ -0,0 +1,110 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "startupbenchmark.h"
+
+#include <QtSDL.h>
+#include <QtSDL/sdleventmanager.h>
+
+#include <QElapsedTimer>
+#include <SDL3/SDL_hints.h>
+
+namespace {
+
+/**
+ * @brief The number of initializations averaged for each variant.
+ */
+constexpr int ROUNDS = 5;
+
+/**
+ * @brief The time in milliseconds a started manager may take to run after the asynchronous initialization.
+ */
+constexpr int START_TIMEOUT = 5000;
+
+/**
+ * @brief The Startup struct is the average timing of one variant in milliseconds.
+ */
+struct Startup {
+    /// The time the caller was blocked.
+    double blocked = 0;
+    /// The time until the initialization finished.
+    double ready = 0;
+};
+
+Startup measure(const QtSDL::InitOptions& options, bool async) {
+    Startup result;
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        QElapsedTimer timer;
+        timer.start();
+
+        bool success = false;
+        if (async) {
+            QFuture<bool> future = QtSDL::initAsync(options);
+            result.blocked += timer.nsecsElapsed() / 1e6;
+            future.waitForFinished();
+            success = future.result();
+        } else {
+            success = QtSDL::init(options);
+            result.blocked += timer.nsecsElapsed() / 1e6;
+        }
+
+        result.ready += timer.nsecsElapsed() / 1e6;
+        SDL_Quit();
+
+        if (!success) {
+            return {-1, -1};
+        }
+    }
+
+    result.blocked /= ROUNDS;
+    result.ready /= ROUNDS;
+    return result;
+}
+
+void report(const char* variant, const Startup& startup) {
+    qInfo().nospace() << "StartupBenchmark: " << variant << ", caller blocked " << startup.blocked
+                      << " ms, ready after " << startup.ready << " ms";
+}
+}
+
+StartupBenchmark::StartupBenchmark() {
+
+}
+
+StartupBenchmark::~StartupBenchmark() {
+
+}
+
+void StartupBenchmark::test() {
+    QtSDL::InitOptions options;
+
+    const Startup sync = measure(options, false);
+    QVERIFY(sync.ready >= 0);
+    report("init", sync);
+
+    const Startup async = measure(options, true);
+    QVERIFY(async.ready >= 0);
+    report("initAsync", async);
+
+    options.hints = {{SDL_HINT_JOYSTICK_HIDAPI, "0"}};
+    const Startup withoutHidapi = measure(options, false);
+    QVERIFY(withoutHidapi.ready >= 0);
+    report("init without HIDAPI", withoutHidapi);
+    // Reset the hint, so the variant without HIDAPI drivers does not leak into other benchmarks.
+    SDL_ResetHint(SDL_HINT_JOYSTICK_HIDAPI);
+
+    // The manager created before the initialization finishes starts on its own.
+    QtSDL::SDLEventManager manager;
+
+    QElapsedTimer timer;
+    timer.start();
+    manager.start(QtSDL::initAsync());
+    QVERIFY(wait([&manager]() { return manager.isRunning(); }, START_TIMEOUT));
+    qInfo().nospace() << "StartupBenchmark: manager running after " << timer.nsecsElapsed() / 1e6 << " ms";
+}
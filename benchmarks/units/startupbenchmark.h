@@ -0,0 +1,29 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef STARTUPBENCHMARK_H
+#define STARTUPBENCHMARK_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The StartupBenchmark class measures how long `QtSDL::init()` blocks the caller compared to `QtSDL::initAsync()`.
+ */
+class StartupBenchmark: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    StartupBenchmark();
+    ~StartupBenchmark();
+
+    void test();
+};
+
+#endif // STARTUPBENCHMARK_H
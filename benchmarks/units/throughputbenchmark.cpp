@@ -0,0 +1,137 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "throughputbenchmark.h"
+#include "allocationcounter.h"
+#include "benchmarksession.h"
+
+#include <QtSDL/qsdleventpool.h>
+
+#include <QElapsedTimer>
+
+using QtSDL::SDLEventManager;
+
+namespace {
+
+/**
+ * @brief The number of events pushed into the SDL queue at once. It stays well below the SDL queue limit.
+ */
+constexpr qsizetype CHUNK = 4096;
+
+/**
+ * @brief The number of chunks used to compare the delivery modes.
+ */
+constexpr int ROUNDS = 64;
+
+/**
+ * @brief Builds a mix of axis, button, touchpad and sensor events of one device.
+ *
+ * Virtual joysticks report only the latest state of each control per SDL update,
+ * so the events are pushed into the SDL queue directly to saturate the manager.
+ */
+QList<SDL_Event> makeEvents(SDL_JoystickID device, qsizetype count) {
+    QList<SDL_Event> events(count);
+
+    for (qsizetype i = 0; i < count; ++i) {
+        SDL_Event& event = events[i];
+        SDL_zero(event);
+
+        switch (i % 4) {
+        case 0:
+            event.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+            event.gaxis.which = device;
+            event.gaxis.axis = static_cast<Uint8>(i % SDL_GAMEPAD_AXIS_COUNT);
+            event.gaxis.value = static_cast<Sint16>((i * 97) % 65536 - 32768);
+            break;
+        case 1:
+            event.type = ((i / 4) % 2)? SDL_EVENT_GAMEPAD_BUTTON_UP: SDL_EVENT_GAMEPAD_BUTTON_DOWN;
+            event.gbutton.which = device;
+            event.gbutton.button = static_cast<Uint8>((i / 8) % SDL_GAMEPAD_BUTTON_COUNT);
+            event.gbutton.down = event.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN;
+            break;
+        case 2:
+            event.type = SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION;
+            event.gtouchpad.which = device;
+            event.gtouchpad.x = static_cast<float>(i % 100) / 100.0f;
+            event.gtouchpad.y = 0.5f;
+            event.gtouchpad.pressure = 1.0f;
+            break;
+        default:
+            event.type = SDL_EVENT_GAMEPAD_SENSOR_UPDATE;
+            event.gsensor.which = device;
+            event.gsensor.sensor = SDL_SENSOR_GYRO;
+            event.gsensor.data[0] = 0.1f;
+            event.gsensor.data[1] = -0.2f;
+            event.gsensor.data[2] = 0.3f;
+            break;
+        }
+    }
+
+    return events;
+}
+
+void pushEvents(const QList<SDL_Event>& events) {
+    for (SDL_Event event: events) {
+        // A zero timestamp is replaced with the push time by SDL.
+        SDL_PushEvent(&event);
+    }
+}
+}
+
+ThroughputBenchmark::ThroughputBenchmark() {
+
+}
+
+ThroughputBenchmark::~ThroughputBenchmark() {
+
+}
+
+void ThroughputBenchmark::test() {
+    BenchmarkSession session;
+    QVERIFY(session.start());
+
+    EventProbe& probe = session.probe();
+    SDLEventManager& manager = session.manager();
+    manager.setWaitMode(SDLEventManager::WaitMode::Wait);
+
+    const QList<SDL_Event> events = makeEvents(session.gamepad().id(), CHUNK);
+
+    probe.reset();
+    qint64 sent = 0;
+    QBENCHMARK {
+        pushEvents(events);
+        sent += CHUNK;
+        QVERIFY(wait([&]() { return probe.inputEvents() >= sent; }, 10000));
+    }
+
+    const SDLEventManager::DeliveryMode modes[] = {SDLEventManager::DeliveryMode::PerEvent,
+                                                   SDLEventManager::DeliveryMode::Batched};
+    for (auto mode: modes) {
+        manager.setDeliveryMode(mode);
+        probe.reset();
+        QtSDL::QSDLEventPool::resetStats();
+        AllocationCounter::reset();
+
+        QElapsedTimer timer;
+        timer.start();
+        for (int round = 1; round <= ROUNDS; ++round) {
+            pushEvents(events);
+            QVERIFY(wait([&]() { return probe.inputEvents() >= round * CHUNK; }, 10000));
+        }
+
+        const double seconds = timer.nsecsElapsed() / 1e9;
+        const double total = static_cast<double>(probe.inputEvents());
+        const auto pool = QtSDL::QSDLEventPool::stats();
+
+        qInfo().nospace() << "ThroughputBenchmark: "
+                          << ((mode == SDLEventManager::DeliveryMode::Batched)? "batched": "per event")
+                          << " delivery: " << qRound64(total / seconds) << " events/s, "
+                          << AllocationCounter::count() / total << " allocations/event, "
+                          << pool.misses / total << " pool misses/event";
+    }
+}
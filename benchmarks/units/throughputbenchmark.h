@@ -0,0 +1,29 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef THROUGHPUTBENCHMARK_H
+#define THROUGHPUTBENCHMARK_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The ThroughputBenchmark class measures how many events per second `SDLEventManager` delivers and how many allocations each event costs.
+ */
+class ThroughputBenchmark: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    ThroughputBenchmark();
+    ~ThroughputBenchmark();
+
+    void test();
+};
+
+#endif // THROUGHPUTBENCHMARK_H
@@ -0,0 +1,90 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "virtualgamepad.h"
+
+#include <SDL3/SDL_gamepad.h>
+#include <QDebug>
+
+VirtualGamepad::VirtualGamepad() {
+
+}
+
+VirtualGamepad::~VirtualGamepad() {
+    detach();
+}
+
+bool VirtualGamepad::attach() {
+    if (_id) {
+        return true;
+    }
+
+    static const SDL_VirtualJoystickTouchpadDesc touchpads[] = {{2, {}}};
+    static const SDL_VirtualJoystickSensorDesc sensors[] = {
+        {SDL_SENSOR_ACCEL, 1000.0f},
+        {SDL_SENSOR_GYRO, 1000.0f},
+    };
+
+    SDL_VirtualJoystickDesc desc;
+    SDL_INIT_INTERFACE(&desc);
+    desc.type = SDL_JOYSTICK_TYPE_GAMEPAD;
+    desc.naxes = SDL_GAMEPAD_AXIS_COUNT;
+    desc.nbuttons = SDL_GAMEPAD_BUTTON_COUNT;
+    desc.ntouchpads = 1;
+    desc.nsensors = 2;
+    desc.touchpads = touchpads;
+    desc.sensors = sensors;
+    desc.name = "QtSDL benchmark gamepad";
+
+    _id = SDL_AttachVirtualJoystick(&desc);
+    if (!_id) {
+        qWarning() << "VirtualGamepad: failed to attach a virtual joystick:" << SDL_GetError();
+        return false;
+    }
+
+    _joystick = SDL_OpenJoystick(_id);
+    if (!_joystick) {
+        qWarning() << "VirtualGamepad: failed to open the virtual joystick:" << SDL_GetError();
+        detach();
+        return false;
+    }
+
+    return true;
+}
+
+void VirtualGamepad::detach() {
+    if (_joystick) {
+        SDL_CloseJoystick(_joystick);
+        _joystick = nullptr;
+    }
+
+    if (_id) {
+        SDL_DetachVirtualJoystick(_id);
+        _id = 0;
+    }
+}
+
+SDL_JoystickID VirtualGamepad::id() const {
+    return _id;
+}
+
+void VirtualGamepad::setAxis(int axis, Sint16 value) {
+    SDL_SetJoystickVirtualAxis(_joystick, axis, value);
+}
+
+void VirtualGamepad::setButton(int button, bool down) {
+    SDL_SetJoystickVirtualButton(_joystick, button, down);
+}
+
+void VirtualGamepad::setTouchpad(int finger, bool down, float x, float y) {
+    SDL_SetJoystickVirtualTouchpad(_joystick, 0, finger, down, x, y, (down)? 1.0f: 0.0f);
+}
+
+void VirtualGamepad::sendSensor(SDL_SensorType type, Uint64 timestamp, const float *data) {
+    SDL_SendJoystickVirtualSensorData(_joystick, type, timestamp, data, 3);
+}
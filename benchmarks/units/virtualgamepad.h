@@ -0,0 +1,53 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef VIRTUALGAMEPAD_H
+#define VIRTUALGAMEPAD_H
+
+#include <SDL3/SDL_joystick.h>
+#include <SDL3/SDL_sensor.h>
+
+/**
+ * @brief The VirtualGamepad class attaches an SDL virtual joystick that is recognized as a gamepad.
+ *
+ * The gamepad has all standard axes and buttons, one touchpad with two fingers, an accelerometer
+ * and a gyroscope. It needs no hardware, so the benchmarks can drive input on headless CI machines.
+ */
+class VirtualGamepad
+{
+public:
+    VirtualGamepad();
+    ~VirtualGamepad();
+
+    /**
+     * @brief Attaches and opens the virtual joystick. SDL must be initialized.
+     * @return true if the virtual joystick is attached.
+     */
+    bool attach();
+
+    /**
+     * @brief Closes and detaches the virtual joystick.
+     */
+    void detach();
+
+    /**
+     * @brief Returns the SDL joystick instance id of the virtual gamepad, or 0 if it is not attached.
+     */
+    SDL_JoystickID id() const;
+
+    void setAxis(int axis, Sint16 value);
+    void setButton(int button, bool down);
+    void setTouchpad(int finger, bool down, float x, float y);
+    void sendSensor(SDL_SensorType type, Uint64 timestamp, const float* data);
+
+private:
+    SDL_JoystickID _id = 0;
+    SDL_Joystick* _joystick = nullptr;
+};
+
+#endif // VIRTUALGAMEPAD_H
@@ -6,14 +6,38 @@
 //#
 
 #include "QtSDL.h"
+#include <QMutex>
+#include <QPromise>
 #include <QThread>
+#include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_init.h>
+#include <memory>
 #include <qdebug.h>
 
 namespace QtSDL {
 
+namespace {
+
+/**
+ * @brief Serializes the initializations started from different threads.
+ */
+QMutex initMutex;
+}
+
 bool init() {
-    if (!SDL_Init(SDL_INIT_GAMEPAD)) {
+    return init(InitOptions{});
+}
+
+bool init(const InitOptions &options) {
+    QMutexLocker locker(&initMutex);
+
+    for (const auto& hint : options.hints) {
+        if (!SDL_SetHint(hint.first.constData(), hint.second.constData())) {
+            qWarning() << "SDL_SetHint failed:" << hint.first.constData() << SDL_GetError();
+        }
+    }
+
+    if (!SDL_Init(options.subsystems)) {
         qCritical() << "SDL_Init failed:" << SDL_GetError();
         return false;
     }
@@ -21,6 +45,21 @@ bool init() {
     return true;
 }
 
+QFuture<bool> initAsync(const InitOptions &options) {
+    auto promise = std::make_shared<QPromise<bool>>();
+    QFuture<bool> future = promise->future();
+    promise->start();
+
+    QThread* thread = QThread::create([promise, options]() {
+        promise->addResult(init(options));
+        promise->finish();
+    });
+    QObject::connect(thread, &QThread::finished, thread, &QObject::deleteLater);
+    thread->start();
+
+    return future;
+}
+
 QString version() {
     return QTSDL_VERSION;
 }
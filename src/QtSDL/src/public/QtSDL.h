@@ -5,18 +5,62 @@
 //# of this license document, but changing it is not allowed.
 //#
 
+#ifndef QTSDL_H
+#define QTSDL_H
+
 #include "QtSDL/global.h"
+#include <QByteArray>
+#include <QFuture>
+#include <QList>
 #include <QString>
+#include <SDL3/SDL_init.h>
+#include <utility>
 
 
 namespace QtSDL {
 
+/**
+ * @brief The InitOptions struct configures the initialization of SDL.
+ */
+struct QTSDL_EXPORT InitOptions {
+    /// The SDL subsystems to initialize.
+    SDL_InitFlags subsystems = SDL_INIT_GAMEPAD;
+    /**
+     * @brief The SDL hints set before the initialization, as name and value pairs.
+     *
+     * For example `{SDL_HINT_JOYSTICK_HIDAPI_PS5, "0"}` skips a HIDAPI driver and
+     * `{SDL_HINT_JOYSTICK_THREAD, "1"}` reads the joysticks on a separate SDL thread.
+     */
+    QList<std::pair<QByteArray, QByteArray>> hints;
+};
+
 /**
  * @brief init main initialize method of The QtSDL library
  * @return true if library initialized successfull
  */
 bool QTSDL_EXPORT init();
 
+/**
+ * @brief init initializes the selected SDL subsystems on the caller's thread.
+ * @param options The subsystems and the hints.
+ * @return true if library initialized successfull
+ */
+bool QTSDL_EXPORT init(const InitOptions& options);
+
+/**
+ * @brief initAsync initializes the selected SDL subsystems on a background thread.
+ *
+ * The device enumeration of SDL can take hundreds of milliseconds on machines with many HID devices,
+ * so this method returns immediately. Pass the future to `SDLEventManager::start()` to start
+ * the manager once the initialization finishes. Do not call other SDL functions and do not destroy
+ * a manager until the future is finished.
+ *
+ * @note Initialize `SDL_INIT_VIDEO` with `init()` on the main thread, some platforms require it.
+ * @param options The subsystems and the hints.
+ * @return The future with the result of the initialization.
+ */
+QFuture<bool> QTSDL_EXPORT initAsync(const InitOptions& options = {});
+
 /**
  * @brief version This method return string value of a library version
  * @return string value of a library version
@@ -24,3 +68,5 @@ bool QTSDL_EXPORT init();
 QString QTSDL_EXPORT version();
 
 };
+
+#endif // QTSDL_H
@@ -0,0 +1,74 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "deviceallowlist.h"
+#include <cstring>
+
+namespace QtSDL {
+
+void DeviceAllowlist::addGuid(const SDL_GUID &guid) {
+    _guids.append(guid);
+}
+
+void DeviceAllowlist::addVendorProduct(Uint16 vendor, Uint16 product) {
+    _vendorProducts.append((static_cast<quint32>(vendor) << 16) | product);
+}
+
+const QList<SDL_GUID> &DeviceAllowlist::guids() const {
+    return _guids;
+}
+
+const QList<quint32> &DeviceAllowlist::vendorProducts() const {
+    return _vendorProducts;
+}
+
+bool DeviceAllowlist::isEmpty() const {
+    return _guids.isEmpty() && _vendorProducts.isEmpty();
+}
+
+bool DeviceAllowlist::accepts(const SDL_GUID &guid, Uint16 vendor, Uint16 product) const {
+    if (isEmpty()) {
+        return true;
+    }
+
+    for (const SDL_GUID& allowed : _guids) {
+        if (!std::memcmp(allowed.data, guid.data, sizeof(guid.data))) {
+            return true;
+        }
+    }
+
+    for (quint32 allowed : _vendorProducts) {
+        const Uint16 allowedVendor = allowed >> 16;
+        const Uint16 allowedProduct = allowed & 0xFFFF;
+        if (allowedVendor == vendor && (!allowedProduct || allowedProduct == product)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool DeviceAllowlist::acceptsGamepad(SDL_JoystickID device) const {
+    if (isEmpty()) {
+        return true;
+    }
+
+    return accepts(SDL_GetGamepadGUIDForID(device),
+                   SDL_GetGamepadVendorForID(device),
+                   SDL_GetGamepadProductForID(device));
+}
+
+bool DeviceAllowlist::acceptsJoystick(SDL_JoystickID device) const {
+    if (isEmpty()) {
+        return true;
+    }
+
+    return accepts(SDL_GetJoystickGUIDForID(device),
+                   SDL_GetJoystickVendorForID(device),
+                   SDL_GetJoystickProductForID(device));
+}
+}
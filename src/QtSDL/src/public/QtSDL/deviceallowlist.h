@@ -0,0 +1,87 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef DEVICEALLOWLIST_H
+#define DEVICEALLOWLIST_H
+
+#include <QList>
+#include <SDL3/SDL.h>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The DeviceAllowlist class limits the devices processed by `SDLEventManager`.
+ *
+ * A device is accepted when its GUID is listed in `guids()` or its vendor and product ids
+ * are listed in `vendorProducts()`. An empty allowlist accepts all devices.
+ *
+ * @see SDLEventManager::setDeviceAllowlist
+ */
+class QTSDL_EXPORT DeviceAllowlist
+{
+public:
+    DeviceAllowlist() = default;
+
+    /**
+     * @brief Adds a device GUID to the allowlist.
+     * @param guid The SDL GUID of the device.
+     */
+    void addGuid(const SDL_GUID& guid);
+
+    /**
+     * @brief Adds a vendor/product pair to the allowlist.
+     * @param vendor The USB vendor id.
+     * @param product The USB product id, or 0 to accept all products of the vendor.
+     */
+    void addVendorProduct(Uint16 vendor, Uint16 product = 0);
+
+    /**
+     * @brief Returns the accepted device GUIDs.
+     */
+    const QList<SDL_GUID>& guids() const;
+
+    /**
+     * @brief Returns the accepted vendor/product pairs, packed as `(vendor << 16) | product`.
+     */
+    const QList<quint32>& vendorProducts() const;
+
+    /**
+     * @brief Checks whether the allowlist is empty and accepts all devices.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Checks whether the device is accepted.
+     * @param guid The SDL GUID of the device.
+     * @param vendor The USB vendor id of the device.
+     * @param product The USB product id of the device.
+     * @return true if the device is accepted.
+     */
+    bool accepts(const SDL_GUID& guid, Uint16 vendor, Uint16 product) const;
+
+    /**
+     * @brief Checks whether the gamepad is accepted, reading its GUID and ids from SDL.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @return true if the gamepad is accepted.
+     */
+    bool acceptsGamepad(SDL_JoystickID device) const;
+
+    /**
+     * @brief Checks whether the joystick is accepted, reading its GUID and ids from SDL.
+     * @param device The SDL joystick instance id of the joystick.
+     * @return true if the joystick is accepted.
+     */
+    bool acceptsJoystick(SDL_JoystickID device) const;
+
+private:
+    QList<SDL_GUID> _guids;
+    QList<quint32> _vendorProducts;
+};
+} // namespace QtSDL
+#endif // DEVICEALLOWLIST_H
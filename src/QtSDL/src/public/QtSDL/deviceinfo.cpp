@@ -0,0 +1,96 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "deviceinfo.h"
+
+namespace QtSDL {
+
+bool DeviceInfo::hasAxis(SDL_GamepadAxis axis) const {
+    return axis >= 0 && axis < 32 && (axes >> axis) & 1;
+}
+
+bool DeviceInfo::hasButton(SDL_GamepadButton button) const {
+    return button >= 0 && button < 64 && (buttons >> button) & 1;
+}
+
+bool DeviceInfo::hasSensor(SDL_SensorType sensor) const {
+    return sensor >= 0 && sensor < 32 && (sensors >> sensor) & 1;
+}
+
+DeviceInfo DeviceInfo::capture(SDL_JoystickID id, SDL_Gamepad *gamepad) {
+    DeviceInfo info;
+    info.id = id;
+    info.name = QString::fromUtf8(SDL_GetGamepadNameForID(id));
+    info.type = SDL_GetGamepadTypeForID(id);
+    info.vendor = SDL_GetGamepadVendorForID(id);
+    info.product = SDL_GetGamepadProductForID(id);
+    info.guid = SDL_GetGamepadGUIDForID(id);
+    info.playerIndex = SDL_GetGamepadPlayerIndexForID(id);
+
+    if (!gamepad) {
+        return info;
+    }
+
+    info.serial = QByteArray(SDL_GetGamepadSerial(gamepad));
+
+    for (int axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; ++axis) {
+        if (SDL_GamepadHasAxis(gamepad, static_cast<SDL_GamepadAxis>(axis))) {
+            info.axes |= quint32(1) << axis;
+        }
+    }
+
+    for (int button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; ++button) {
+        if (SDL_GamepadHasButton(gamepad, static_cast<SDL_GamepadButton>(button))) {
+            info.buttons |= quint64(1) << button;
+        }
+    }
+
+    for (SDL_SensorType sensor : {SDL_SENSOR_ACCEL, SDL_SENSOR_GYRO, SDL_SENSOR_ACCEL_L,
+                                  SDL_SENSOR_GYRO_L, SDL_SENSOR_ACCEL_R, SDL_SENSOR_GYRO_R}) {
+        if (SDL_GamepadHasSensor(gamepad, sensor)) {
+            info.sensors |= quint32(1) << sensor;
+        }
+    }
+
+    info.touchpads = SDL_GetNumGamepadTouchpads(gamepad);
+
+    const SDL_PropertiesID properties = SDL_GetGamepadProperties(gamepad);
+    info.rumble = SDL_GetBooleanProperty(properties, SDL_PROP_GAMEPAD_CAP_RUMBLE_BOOLEAN, false);
+    info.triggerRumble = SDL_GetBooleanProperty(properties, SDL_PROP_GAMEPAD_CAP_TRIGGER_RUMBLE_BOOLEAN, false);
+    info.led = SDL_GetBooleanProperty(properties, SDL_PROP_GAMEPAD_CAP_RGB_LED_BOOLEAN, false);
+
+    return info;
+}
+
+DeviceInfo DeviceInfo::captureJoystick(SDL_JoystickID id, SDL_Joystick *joystick) {
+    DeviceInfo info;
+    info.kind = Kind::Joystick;
+    info.id = id;
+    info.name = QString::fromUtf8(SDL_GetJoystickNameForID(id));
+    info.vendor = SDL_GetJoystickVendorForID(id);
+    info.product = SDL_GetJoystickProductForID(id);
+    info.guid = SDL_GetJoystickGUIDForID(id);
+    info.playerIndex = SDL_GetJoystickPlayerIndexForID(id);
+
+    if (!joystick) {
+        return info;
+    }
+
+    info.serial = QByteArray(SDL_GetJoystickSerial(joystick));
+    info.joystickAxes = SDL_GetNumJoystickAxes(joystick);
+    info.joystickButtons = SDL_GetNumJoystickButtons(joystick);
+    info.joystickHats = SDL_GetNumJoystickHats(joystick);
+    info.joystickBalls = SDL_GetNumJoystickBalls(joystick);
+
+    const SDL_PropertiesID properties = SDL_GetJoystickProperties(joystick);
+    info.rumble = SDL_GetBooleanProperty(properties, SDL_PROP_JOYSTICK_CAP_RUMBLE_BOOLEAN, false);
+    info.triggerRumble = SDL_GetBooleanProperty(properties, SDL_PROP_JOYSTICK_CAP_TRIGGER_RUMBLE_BOOLEAN, false);
+    info.led = SDL_GetBooleanProperty(properties, SDL_PROP_JOYSTICK_CAP_RGB_LED_BOOLEAN, false);
+
+    return info;
+}
+}
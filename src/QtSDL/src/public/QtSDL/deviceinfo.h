@@ -0,0 +1,114 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef DEVICEINFO_H
+#define DEVICEINFO_H
+
+#include <QByteArray>
+#include <QString>
+#include <SDL3/SDL.h>
+#include "deviceslot.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The DeviceInfo struct describes a connected gamepad or joystick.
+ *
+ * `SDLEventManager` captures the block once when the device is added and never changes it,
+ * so it can be read from any thread without calling back into SDL.
+ * @see SDLEventManager::deviceInfo
+ */
+struct QTSDL_EXPORT DeviceInfo {
+    /**
+     * @brief The Kind enum defines how the device was opened.
+     */
+    enum class Kind {
+        /// The device is a gamepad with a standard layout.
+        Gamepad,
+        /// The device is a plain joystick, for example a flight stick or a racing wheel.
+        Joystick
+    };
+
+    /// How the device was opened.
+    Kind kind = Kind::Gamepad;
+    /// The SDL joystick instance id of the gamepad.
+    SDL_JoystickID id = 0;
+    /// The slot of the gamepad.
+    DeviceSlot slot;
+    /// The name of the gamepad.
+    QString name;
+    /// The type of the gamepad.
+    SDL_GamepadType type = SDL_GAMEPAD_TYPE_UNKNOWN;
+    /// The USB vendor id, or 0 if it is not available.
+    Uint16 vendor = 0;
+    /// The USB product id, or 0 if it is not available.
+    Uint16 product = 0;
+    /// The GUID of the gamepad.
+    SDL_GUID guid {};
+    /// The serial number, or an empty array if it is not available.
+    QByteArray serial;
+    /// The player index at the moment the gamepad was added, or -1.
+    int playerIndex = -1;
+    /// The bitmask of the available axes, the bit N corresponds to the `SDL_GamepadAxis` N.
+    quint32 axes = 0;
+    /// The bitmask of the available buttons, the bit N corresponds to the `SDL_GamepadButton` N.
+    quint64 buttons = 0;
+    /// The bitmask of the available sensors, the bit N corresponds to the `SDL_SensorType` N.
+    quint32 sensors = 0;
+    /// The number of touchpads.
+    int touchpads = 0;
+    /// true if the gamepad has rumble motors.
+    bool rumble = false;
+    /// true if the gamepad has rumble motors in the triggers.
+    bool triggerRumble = false;
+    /// true if the color of the gamepad LED can be set.
+    bool led = false;
+    /// The number of raw axes of a joystick. It is 0 for gamepads, see `axes`.
+    int joystickAxes = 0;
+    /// The number of raw buttons of a joystick. It is 0 for gamepads, see `buttons`.
+    int joystickButtons = 0;
+    /// The number of hats of a joystick.
+    int joystickHats = 0;
+    /// The number of trackballs of a joystick.
+    int joystickBalls = 0;
+
+    /**
+     * @brief Checks whether the gamepad has the given axis.
+     */
+    bool hasAxis(SDL_GamepadAxis axis) const;
+
+    /**
+     * @brief Checks whether the gamepad has the given button.
+     */
+    bool hasButton(SDL_GamepadButton button) const;
+
+    /**
+     * @brief Checks whether the gamepad has the given sensor.
+     */
+    bool hasSensor(SDL_SensorType sensor) const;
+
+    /**
+     * @brief Captures the description of a gamepad.
+     * @param id The SDL joystick instance id of the gamepad.
+     * @param gamepad The opened gamepad, or nullptr for replayed gamepads. The capabilities are
+     * read from the opened gamepad only.
+     * @return The description.
+     */
+    static DeviceInfo capture(SDL_JoystickID id, SDL_Gamepad* gamepad);
+
+    /**
+     * @brief Captures the description of a joystick that is not a gamepad.
+     * @param id The SDL joystick instance id of the joystick.
+     * @param joystick The opened joystick, or nullptr. The capabilities are read from the opened joystick only.
+     * @return The description.
+     */
+    static DeviceInfo captureJoystick(SDL_JoystickID id, SDL_Joystick* joystick);
+};
+} // namespace QtSDL
+#endif // DEVICEINFO_H
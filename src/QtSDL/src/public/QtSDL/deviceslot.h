@@ -0,0 +1,65 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef DEVICESLOT_H
+#define DEVICESLOT_H
+
+#include <QList>
+#include <SDL3/SDL.h>
+#include <utility>
+
+namespace QtSDL {
+
+/**
+ * @brief The DeviceSlot struct is a small stable handle of a connected device.
+ *
+ * `SDLEventManager` places every opened gamepad into a dense slot. The slot index stays the same
+ * while the device is connected and is reused by the next device after a disconnect, so per-device
+ * data of consumers can live in plain arrays indexed by `index`. The generation tells the devices
+ * of one slot apart: it changes each time the slot is reused.
+ */
+struct DeviceSlot {
+    /// The index of the slot, from 0, or -1 if the handle is null.
+    qint16 index = -1;
+    /// The generation of the slot.
+    quint16 generation = 0;
+
+    /**
+     * @brief Checks whether the handle refers to a slot.
+     */
+    constexpr bool isValid() const {
+        return index >= 0;
+    }
+
+    constexpr bool operator==(const DeviceSlot& other) const = default;
+};
+
+/**
+ * @brief The DeviceSlotTable type maps the SDL joystick instance ids of the devices to their slots.
+ *
+ * The table is implicitly shared, so `QSDLEventBatch` carries it without a copy.
+ */
+using DeviceSlotTable = QList<std::pair<SDL_JoystickID, DeviceSlot>>;
+
+/**
+ * @brief Finds the slot of a device in the table.
+ * @param table The table.
+ * @param device The SDL joystick instance id of the device.
+ * @return The slot, or a null slot if the table does not contain the device.
+ */
+inline DeviceSlot findDeviceSlot(const DeviceSlotTable& table, SDL_JoystickID device) {
+    for (const auto& entry : table) {
+        if (entry.first == device) {
+            return entry.second;
+        }
+    }
+
+    return {};
+}
+} // namespace QtSDL
+#endif // DEVICESLOT_H
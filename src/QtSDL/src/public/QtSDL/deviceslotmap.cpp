@@ -0,0 +1,149 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "deviceslotmap.h"
+
+namespace QtSDL {
+
+DeviceSlotMap::DeviceSlotMap() {
+
+}
+
+DeviceSlot DeviceSlotMap::insert(SDL_JoystickID id, SDL_Gamepad *gamepad, DeviceInfo info) {
+    Entry entry;
+    entry.id = id;
+    entry.gamepad = gamepad;
+    return insertEntry(std::move(entry), std::move(info));
+}
+
+DeviceSlot DeviceSlotMap::insertJoystick(SDL_JoystickID id, SDL_Joystick *joystick, DeviceInfo info) {
+    Entry entry;
+    entry.id = id;
+    entry.joystick = joystick;
+    return insertEntry(std::move(entry), std::move(info));
+}
+
+DeviceSlotMap::Entry DeviceSlotMap::remove(SDL_JoystickID id) {
+    const qsizetype position = find(id);
+    if (position < 0) {
+        return {};
+    }
+
+    const Entry entry = _entries.takeAt(position);
+    Entry retired = entry;
+    retired.gamepad = nullptr;
+    retired.joystick = nullptr;
+    _retired.append(std::move(retired));
+    return entry;
+}
+
+bool DeviceSlotMap::releaseRetired() {
+    if (_retired.isEmpty()) {
+        return false;
+    }
+
+    for (const Entry& entry : std::as_const(_retired)) {
+        _taken[entry.slot.index] = false;
+        ++_generations[entry.slot.index];
+    }
+
+    _retired.clear();
+    updateTable();
+    return true;
+}
+
+bool DeviceSlotMap::contains(SDL_JoystickID id) const {
+    return find(id) >= 0;
+}
+
+SDL_Gamepad *DeviceSlotMap::gamepad(SDL_JoystickID id) const {
+    const qsizetype position = find(id);
+    return (position >= 0)? _entries[position].gamepad: nullptr;
+}
+
+SDL_Joystick *DeviceSlotMap::joystick(SDL_JoystickID id) const {
+    const qsizetype position = find(id);
+    return (position >= 0)? _entries[position].joystick: nullptr;
+}
+
+std::shared_ptr<const DeviceInfo> DeviceSlotMap::info(SDL_JoystickID id) const {
+    const qsizetype position = find(id);
+    return (position >= 0)? _entries[position].info: nullptr;
+}
+
+DeviceSlot DeviceSlotMap::slot(SDL_JoystickID id) const {
+    return findDeviceSlot(_table, id);
+}
+
+const QList<DeviceSlotMap::Entry> &DeviceSlotMap::entries() const {
+    return _entries;
+}
+
+QList<SDL_JoystickID> DeviceSlotMap::ids() const {
+    QList<SDL_JoystickID> result;
+    result.reserve(_entries.size());
+    for (const Entry& entry : _entries) {
+        result.append(entry.id);
+    }
+
+    return result;
+}
+
+const DeviceSlotTable &DeviceSlotMap::table() const {
+    return _table;
+}
+
+qsizetype DeviceSlotMap::slotCount() const {
+    return _taken.size();
+}
+
+qsizetype DeviceSlotMap::find(SDL_JoystickID id) const {
+    for (qsizetype position = 0; position < _entries.size(); ++position) {
+        if (_entries[position].id == id) {
+            return position;
+        }
+    }
+
+    return -1;
+}
+
+DeviceSlot DeviceSlotMap::insertEntry(Entry entry, DeviceInfo info) {
+    Q_ASSERT_X(find(entry.id) < 0, __FUNCTION__, "the device is already in the map");
+
+    qsizetype index = _taken.indexOf(false);
+    if (index < 0) {
+        index = _taken.size();
+        _taken.append(false);
+        _generations.append(0);
+    }
+
+    _taken[index] = true;
+    info.slot = {static_cast<qint16>(index), _generations[index]};
+
+    entry.slot = info.slot;
+    entry.info = std::make_shared<const DeviceInfo>(std::move(info));
+    _entries.append(std::move(entry));
+    updateTable();
+    return _entries.constLast().slot;
+}
+
+void DeviceSlotMap::updateTable() {
+    // A new table is built instead of changing the shared one, so the batches keep their copy.
+    DeviceSlotTable table;
+    table.reserve(_entries.size() + _retired.size());
+
+    // The opened devices come first: a replayed id may be retired and opened again in one cycle.
+    for (const Entry& entry : std::as_const(_entries)) {
+        table.append({entry.id, entry.slot});
+    }
+    for (const Entry& entry : std::as_const(_retired)) {
+        table.append({entry.id, entry.slot});
+    }
+
+    _table = std::move(table);
+}
+}
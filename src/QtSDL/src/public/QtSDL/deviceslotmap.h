@@ -0,0 +1,151 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef DEVICESLOTMAP_H
+#define DEVICESLOTMAP_H
+
+#include <QList>
+#include <SDL3/SDL.h>
+#include <memory>
+#include "deviceinfo.h"
+#include "deviceslot.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The DeviceSlotMap class stores the opened gamepads and joysticks of `SDLEventManager` in dense, generation-checked slots.
+ *
+ * A new device takes the lowest free slot. A removed device is retired: it keeps its slot until
+ * `releaseRetired()`, so the events of the cycle in which it was removed still resolve its slot,
+ * while `contains()` already reports it as gone. The map holds a few devices, so the lookups
+ * are linear scans of a contiguous array, which beat hashing at this size.
+ *
+ * The class is not thread-safe, it is used by the manager thread only.
+ */
+class QTSDL_EXPORT DeviceSlotMap
+{
+public:
+    /**
+     * @brief The Entry struct is an opened device.
+     */
+    struct Entry {
+        /// The SDL joystick instance id of the device.
+        SDL_JoystickID id = 0;
+        /// The opened gamepad, or nullptr for replayed gamepads.
+        SDL_Gamepad* gamepad = nullptr;
+        /// The opened joystick of a device that is not a gamepad, or nullptr.
+        SDL_Joystick* joystick = nullptr;
+        /// The slot of the device.
+        DeviceSlot slot;
+        /// The description of the device.
+        std::shared_ptr<const DeviceInfo> info;
+    };
+
+    DeviceSlotMap();
+
+    /**
+     * @brief Places a device into the lowest free slot.
+     * @param id The SDL joystick instance id of the device. It must not be in the map.
+     * @param gamepad The opened gamepad, or nullptr.
+     * @param info The description of the device. Its slot is filled by the map.
+     * @return The slot of the device.
+     */
+    DeviceSlot insert(SDL_JoystickID id, SDL_Gamepad* gamepad, DeviceInfo info);
+
+    /**
+     * @brief Places a joystick that is not a gamepad into the lowest free slot.
+     * @param id The SDL joystick instance id of the device. It must not be in the map.
+     * @param joystick The opened joystick, or nullptr.
+     * @param info The description of the device. Its slot is filled by the map.
+     * @return The slot of the device.
+     */
+    DeviceSlot insertJoystick(SDL_JoystickID id, SDL_Joystick* joystick, DeviceInfo info);
+
+    /**
+     * @brief Retires a device.
+     * @param id The SDL joystick instance id of the device.
+     * @return The removed entry with the handles to close, or an empty entry if the device is not opened.
+     */
+    Entry remove(SDL_JoystickID id);
+
+    /**
+     * @brief Frees the slots of the retired devices.
+     * @return true if at least one slot was freed.
+     */
+    bool releaseRetired();
+
+    /**
+     * @brief Checks whether a device is opened.
+     */
+    bool contains(SDL_JoystickID id) const;
+
+    /**
+     * @brief Returns the gamepad of an opened device, or nullptr.
+     */
+    SDL_Gamepad* gamepad(SDL_JoystickID id) const;
+
+    /**
+     * @brief Returns the joystick of an opened joystick device, or nullptr.
+     */
+    SDL_Joystick* joystick(SDL_JoystickID id) const;
+
+    /**
+     * @brief Returns the description of an opened device, or nullptr.
+     */
+    std::shared_ptr<const DeviceInfo> info(SDL_JoystickID id) const;
+
+    /**
+     * @brief Returns the slot of an opened device or of a device retired in the current cycle.
+     * @return The slot, or a null slot for unknown devices.
+     */
+    DeviceSlot slot(SDL_JoystickID id) const;
+
+    /**
+     * @brief Returns the opened devices.
+     */
+    const QList<Entry>& entries() const;
+
+    /**
+     * @brief Returns the ids of the opened devices.
+     */
+    QList<SDL_JoystickID> ids() const;
+
+    /**
+     * @brief Returns the slot table of the opened and retired devices. The table is implicitly shared.
+     */
+    const DeviceSlotTable& table() const;
+
+    /**
+     * @brief Returns the number of slots, that is the largest slot index plus one.
+     */
+    qsizetype slotCount() const;
+
+private:
+    /**
+     * @brief Returns the position of an opened device in `_entries`, or -1.
+     */
+    qsizetype find(SDL_JoystickID id) const;
+
+    /**
+     * @brief Places an entry into the lowest free slot.
+     */
+    DeviceSlot insertEntry(Entry entry, DeviceInfo info);
+
+    void updateTable();
+
+    QList<Entry> _entries;
+    QList<Entry> _retired;
+    /// The current generation of each slot.
+    QList<quint16> _generations;
+    /// true for each slot taken by an opened or retired device.
+    QList<bool> _taken;
+    DeviceSlotTable _table;
+};
+} // namespace QtSDL
+#endif // DEVICESLOTMAP_H
@@ -0,0 +1,287 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "gamepadactionmapper.h"
+#include <QDebug>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace QtSDL {
+
+namespace {
+
+constexpr float AXIS_SCALE = 1.0f / 32767.0f;
+}
+
+void GamepadActionMap::addAction(int id, const QString &name, const QList<Binding> &bindings) {
+    actions.append({id, name, bindings});
+}
+
+GamepadActionMap::Binding GamepadActionMap::button(SDL_GamepadButton button) {
+    return {{button}, {}};
+}
+
+GamepadActionMap::Binding GamepadActionMap::chord(const QList<SDL_GamepadButton> &buttons) {
+    return {buttons, {}};
+}
+
+GamepadActionMap::Binding GamepadActionMap::axis(SDL_GamepadAxis axis, float threshold, float hysteresis) {
+    return {{}, {{axis, threshold, hysteresis}}};
+}
+
+std::shared_ptr<const GamepadActionMapper::Compiled> GamepadActionMapper::Compiled::compile(const GamepadActionMap &map) {
+    auto compiled = std::make_shared<Compiled>();
+    compiled->forwardInput = map.forwardInput;
+
+    if (map.actions.size() > MAX_ACTIONS) {
+        qWarning() << "GamepadActionMapper: only the first" << MAX_ACTIONS << "actions of the map are evaluated";
+    }
+
+    const int count = static_cast<int>(std::min<qsizetype>(map.actions.size(), MAX_ACTIONS));
+    for (int action = 0; action < count; ++action) {
+        const GamepadActionMap::Action& source = map.actions[action];
+        compiled->ids.append(source.id);
+        compiled->names.append(source.name);
+
+        for (const GamepadActionMap::Binding& binding : source.bindings) {
+            Term term {0, 0, action};
+            bool valid = true;
+
+            for (SDL_GamepadButton button : binding.buttons) {
+                if (button < 0 || button >= SDL_GAMEPAD_BUTTON_COUNT) {
+                    valid = false;
+                    break;
+                }
+                term.buttons |= quint32(1) << button;
+            }
+
+            for (const GamepadActionMap::AxisThreshold& threshold : binding.axes) {
+                if (!valid || threshold.axis < 0 || threshold.axis >= SDL_GAMEPAD_AXIS_COUNT ||
+                    compiled->axisTerms.size() >= MAX_AXIS_TERMS) {
+                    valid = false;
+                    break;
+                }
+
+                const float press = std::clamp(std::abs(threshold.threshold), 0.0f, 1.0f);
+                const float release = std::clamp(press - std::max(threshold.hysteresis, 0.0f), 0.0f, press);
+                term.axisTerms |= quint64(1) << compiled->axisTerms.size();
+                compiled->axisTermMasks[threshold.axis] |= quint64(1) << compiled->axisTerms.size();
+                compiled->axisTerms.append({static_cast<Uint8>(threshold.axis), press, release, threshold.threshold < 0});
+            }
+
+            // A binding without inputs would keep its action active forever.
+            if (!valid || (!term.buttons && !term.axisTerms)) {
+                qWarning() << "GamepadActionMapper: ignored an invalid binding of the action" << source.name;
+                continue;
+            }
+
+            compiled->terms.append(term);
+        }
+    }
+
+    for (const Term& term : std::as_const(compiled->terms)) {
+        const quint64 action = quint64(1) << term.action;
+        for (quint32 buttons = term.buttons; buttons; buttons &= buttons - 1) {
+            compiled->buttonActions[std::countr_zero(buttons)] |= action;
+        }
+
+        for (quint64 axisTerms = term.axisTerms; axisTerms; axisTerms &= axisTerms - 1) {
+            compiled->axisActions[compiled->axisTerms[std::countr_zero(axisTerms)].axis] |= action;
+        }
+    }
+
+    return compiled;
+}
+
+void GamepadActionMapper::setMaps(const GamepadActionMap &defaultMap,
+                                  const QHash<SDL_JoystickID, GamepadActionMap> &deviceMaps,
+                                  Uint64 timestamp, QList<Transition> &transitions) {
+    _defaultMap = Compiled::compile(defaultMap);
+    _deviceMaps.clear();
+    for (auto it = deviceMaps.cbegin(); it != deviceMaps.cend(); ++it) {
+        _deviceMaps.insert(it.key(), Compiled::compile(it.value()));
+    }
+
+    for (auto it = _devices.begin(); it != _devices.end(); ++it) {
+        DeviceState& state = it.value();
+        const std::shared_ptr<const Compiled> previousMap = std::move(state.map);
+        const quint64 previous = state.actions;
+
+        state.map = mapOf(it.key());
+        state.actions = 0;
+        state.axisTerms = 0;
+        updateAxisTerms(state);
+
+        QList<Transition> pressed;
+        evaluate(it.key(), state, ~quint64(0), timestamp, pressed);
+
+        // Actions are matched by id, so an action kept by the new map does not blink.
+        for (quint64 bits = previous; bits; bits &= bits - 1) {
+            const int index = std::countr_zero(bits);
+            const int id = previousMap->ids[index];
+            const qsizetype kept = state.map->ids.indexOf(id);
+            if (kept < 0 || !(state.actions & (quint64(1) << kept))) {
+                transitions.append({it.key(), id, previousMap->names[index], false, timestamp});
+            }
+        }
+
+        for (const Transition& transition : std::as_const(pressed)) {
+            const qsizetype index = previousMap->ids.indexOf(transition.action);
+            if (index < 0 || !(previous & (quint64(1) << index))) {
+                transitions.append(transition);
+            }
+        }
+    }
+}
+
+void GamepadActionMapper::addDevice(SDL_JoystickID device, SDL_Gamepad *gamepad, Uint64 timestamp,
+                                    QList<Transition> &transitions) {
+    DeviceState state;
+    state.map = mapOf(device);
+
+    if (gamepad) {
+        for (int button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; ++button) {
+            if (SDL_GetGamepadButton(gamepad, static_cast<SDL_GamepadButton>(button))) {
+                state.buttons |= quint32(1) << button;
+            }
+        }
+
+        for (int axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; ++axis) {
+            state.axes[axis] = SDL_GetGamepadAxis(gamepad, static_cast<SDL_GamepadAxis>(axis));
+        }
+    }
+
+    updateAxisTerms(state);
+    evaluate(device, state, ~quint64(0), timestamp, transitions);
+    _devices.insert(device, state);
+}
+
+void GamepadActionMapper::removeDevice(SDL_JoystickID device, Uint64 timestamp, QList<Transition> &transitions) {
+    auto it = _devices.find(device);
+    if (it == _devices.end()) {
+        return;
+    }
+
+    emitTransitions(device, *it->map, it->actions, 0, timestamp, transitions);
+    _devices.erase(it);
+}
+
+void GamepadActionMapper::clear() {
+    _devices.clear();
+}
+
+bool GamepadActionMapper::process(const SDL_Event &event, QList<Transition> &transitions) {
+    auto it = _devices.find(event.gdevice.which);
+    if (it == _devices.end()) {
+        return false;
+    }
+
+    DeviceState& state = it.value();
+    const Compiled& map = *state.map;
+    bool bound = false;
+
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+    case SDL_EVENT_GAMEPAD_BUTTON_UP: {
+        const Uint8 button = event.gbutton.button;
+        if (button >= SDL_GAMEPAD_BUTTON_COUNT) {
+            return false;
+        }
+
+        const quint32 bit = quint32(1) << button;
+        state.buttons = (event.gbutton.down)? state.buttons | bit: state.buttons & ~bit;
+        bound = map.buttonActions[button];
+        if (bound) {
+            evaluate(event.gbutton.which, state, map.buttonActions[button], event.gbutton.timestamp, transitions);
+        }
+        break;
+    }
+
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION: {
+        const Uint8 axis = event.gaxis.axis;
+        if (axis >= SDL_GAMEPAD_AXIS_COUNT) {
+            return false;
+        }
+
+        state.axes[axis] = event.gaxis.value;
+        bound = map.axisTermMasks[axis];
+        if (!bound) {
+            break;
+        }
+
+        const quint64 previous = state.axisTerms;
+        updateAxisTerms(state);
+        if (state.axisTerms != previous) {
+            evaluate(event.gaxis.which, state, map.axisActions[axis], event.gaxis.timestamp, transitions);
+        }
+        break;
+    }
+
+    default:
+        return false;
+    }
+
+    return bound && !map.forwardInput;
+}
+
+bool GamepadActionMapper::isActive(SDL_JoystickID device, int action) const {
+    auto it = _devices.constFind(device);
+    if (it == _devices.constEnd()) {
+        return false;
+    }
+
+    const qsizetype index = it->map->ids.indexOf(action);
+    return index >= 0 && (it->actions & (quint64(1) << index));
+}
+
+std::shared_ptr<const GamepadActionMapper::Compiled> GamepadActionMapper::mapOf(SDL_JoystickID device) const {
+    return _deviceMaps.value(device, _defaultMap);
+}
+
+void GamepadActionMapper::updateAxisTerms(DeviceState &state) {
+    const Compiled& map = *state.map;
+    quint64 terms = 0;
+
+    for (qsizetype index = 0; index < map.axisTerms.size(); ++index) {
+        const Compiled::AxisTerm& term = map.axisTerms[index];
+        const float value = state.axes[term.axis] * ((term.negative)? -AXIS_SCALE: AXIS_SCALE);
+        const quint64 bit = quint64(1) << index;
+
+        // An active term is released below the hysteresis band only, so noise at the threshold does not toggle it.
+        const float threshold = (state.axisTerms & bit)? term.release: term.press;
+        if (value >= threshold && value > 0) {
+            terms |= bit;
+        }
+    }
+
+    state.axisTerms = terms;
+}
+
+void GamepadActionMapper::evaluate(SDL_JoystickID device, DeviceState &state, quint64 mask,
+                                   Uint64 timestamp, QList<Transition> &transitions) {
+    quint64 actions = state.actions & ~mask;
+    for (const Compiled::Term& term : std::as_const(state.map->terms)) {
+        const quint64 bit = quint64(1) << term.action;
+        if ((mask & bit) && (state.buttons & term.buttons) == term.buttons &&
+            (state.axisTerms & term.axisTerms) == term.axisTerms) {
+            actions |= bit;
+        }
+    }
+
+    emitTransitions(device, *state.map, state.actions, actions, timestamp, transitions);
+    state.actions = actions;
+}
+
+void GamepadActionMapper::emitTransitions(SDL_JoystickID device, const Compiled &map, quint64 previous,
+                                          quint64 current, Uint64 timestamp, QList<Transition> &transitions) {
+    for (quint64 changed = previous ^ current; changed; changed &= changed - 1) {
+        const int index = std::countr_zero(changed);
+        transitions.append({device, map.ids[index], map.names[index], bool(current & (quint64(1) << index)), timestamp});
+    }
+}
+}
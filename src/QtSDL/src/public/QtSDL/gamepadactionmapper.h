@@ -0,0 +1,277 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef GAMEPADACTIONMAPPER_H
+#define GAMEPADACTIONMAPPER_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <SDL3/SDL.h>
+#include <array>
+#include <memory>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The GamepadActionMap struct declares the actions of a game and the gamepad inputs that trigger them.
+ *
+ * An action is active while at least one of its bindings is active. A binding is active while all
+ * its buttons are held and all its axes are beyond their thresholds, so a binding with several
+ * buttons is a chord.
+ *
+ * @code{cpp}
+ * QtSDL::GamepadActionMap map;
+ * map.addAction(Jump, "jump", {QtSDL::GamepadActionMap::button(SDL_GAMEPAD_BUTTON_SOUTH)});
+ * map.addAction(Accelerate, "accelerate", {QtSDL::GamepadActionMap::axis(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 0.3f)});
+ * map.addAction(Pause, "pause", {QtSDL::GamepadActionMap::chord({SDL_GAMEPAD_BUTTON_BACK, SDL_GAMEPAD_BUTTON_START})});
+ * @endcode
+ * @see SDLEventManager::setActionMap
+ */
+struct QTSDL_EXPORT GamepadActionMap {
+    /**
+     * @brief The AxisThreshold struct turns a gamepad axis into a digital input.
+     */
+    struct AxisThreshold {
+        /// The axis.
+        SDL_GamepadAxis axis = SDL_GAMEPAD_AXIS_INVALID;
+        /// The normalized value at which the input becomes active. A negative threshold
+        /// is reached by values below it, for example -0.5 for a stick pushed to the left.
+        float threshold = 0.5f;
+        /// The distance below the threshold at which the active input is released again.
+        float hysteresis = 0.05f;
+    };
+
+    /**
+     * @brief The Binding struct is one combination of inputs that triggers an action.
+     */
+    struct Binding {
+        /// The buttons that must be held together.
+        QList<SDL_GamepadButton> buttons;
+        /// The axes that must be beyond their thresholds.
+        QList<AxisThreshold> axes;
+    };
+
+    /**
+     * @brief The Action struct is an action and its bindings.
+     */
+    struct Action {
+        /// The id of the action chosen by the application.
+        int id = 0;
+        /// The name of the action.
+        QString name;
+        /// The alternative bindings of the action.
+        QList<Binding> bindings;
+    };
+
+    /// The actions of the map. Only the first `GamepadActionMapper::MAX_ACTIONS` actions are evaluated.
+    QList<Action> actions;
+
+    /// Set to keep delivering the raw events of the bound buttons and axes along with the actions.
+    /// The events of buttons and axes that no action is bound to are always delivered.
+    bool forwardInput = false;
+
+    /**
+     * @brief Appends an action to the map.
+     * @param id The id of the action.
+     * @param name The name of the action.
+     * @param bindings The alternative bindings of the action.
+     */
+    void addAction(int id, const QString& name, const QList<Binding>& bindings);
+
+    /**
+     * @brief Creates a binding of a single button.
+     */
+    static Binding button(SDL_GamepadButton button);
+
+    /**
+     * @brief Creates a binding of a chord of buttons that must be held together.
+     */
+    static Binding chord(const QList<SDL_GamepadButton>& buttons);
+
+    /**
+     * @brief Creates a binding of an axis threshold.
+     * @param axis The axis.
+     * @param threshold The normalized threshold, negative for the negative direction of a stick.
+     * @param hysteresis The release distance below the threshold.
+     */
+    static Binding axis(SDL_GamepadAxis axis, float threshold, float hysteresis = 0.05f);
+};
+
+/**
+ * @brief The GamepadActionMapper class evaluates action maps against gamepad button and axis events.
+ *
+ * Each `GamepadActionMap` is compiled once into bitmask and threshold tables: the buttons of each
+ * binding become a bitmask, each axis threshold becomes a bit of the axis term mask, and every button
+ * and axis knows the bitmask of the actions that depend on it. An event only re-evaluates those
+ * actions, and a `Transition` is produced only when the state of an action changes.
+ *
+ * The mapper is not thread-safe. It is owned and used by the `SDLEventManager` thread.
+ * @see SDLEventManager::setActionMappingEnabled
+ */
+class QTSDL_EXPORT GamepadActionMapper
+{
+public:
+    /// The maximum number of actions of one map.
+    static constexpr int MAX_ACTIONS = 64;
+    /// The maximum number of axis thresholds of one map.
+    static constexpr int MAX_AXIS_TERMS = 64;
+
+    /**
+     * @brief The Transition struct is a change of the state of an action on one gamepad.
+     */
+    struct Transition {
+        /// The SDL joystick instance id of the gamepad.
+        SDL_JoystickID device = 0;
+        /// The id of the action.
+        int action = 0;
+        /// The name of the action.
+        QString name;
+        /// true if the action became active, false if it was released.
+        bool active = false;
+        /// The SDL timestamp (in nanoseconds) of the event that changed the action.
+        Uint64 timestamp = 0;
+    };
+
+    GamepadActionMapper() = default;
+
+    /**
+     * @brief Replaces the maps and re-evaluates the actions of all gamepads with the new maps.
+     *
+     * Actions that are not active anymore, including removed actions, produce release transitions,
+     * and inputs that are already held produce press transitions of the new actions.
+     * @param defaultMap The map of gamepads without their own map.
+     * @param deviceMaps The maps of individual gamepads keyed by the SDL joystick instance id.
+     * @param timestamp The SDL timestamp of the transitions.
+     * @param transitions Receives the transitions.
+     */
+    void setMaps(const GamepadActionMap& defaultMap, const QHash<SDL_JoystickID, GamepadActionMap>& deviceMaps,
+                 Uint64 timestamp, QList<Transition>& transitions);
+
+    /**
+     * @brief Starts tracking a gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param gamepad The opened gamepad used to read the inputs that are already held, or nullptr.
+     * @param timestamp The SDL timestamp of the transitions.
+     * @param transitions Receives the press transitions of the actions that are already active.
+     */
+    void addDevice(SDL_JoystickID device, SDL_Gamepad* gamepad, Uint64 timestamp, QList<Transition>& transitions);
+
+    /**
+     * @brief Stops tracking a disconnected gamepad and releases its active actions.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param timestamp The SDL timestamp of the transitions.
+     * @param transitions Receives the release transitions.
+     */
+    void removeDevice(SDL_JoystickID device, Uint64 timestamp, QList<Transition>& transitions);
+
+    /**
+     * @brief Forgets all gamepads without producing transitions.
+     */
+    void clear();
+
+    /**
+     * @brief Applies a gamepad button or axis event.
+     *
+     * Other events and events of untracked gamepads are ignored.
+     * @param event The SDL event.
+     * @param transitions Receives the transitions caused by the event.
+     * @return true if the button or axis of the event is bound to an action and the map of the gamepad
+     * does not forward the raw input.
+     */
+    bool process(const SDL_Event& event, QList<Transition>& transitions);
+
+    /**
+     * @brief Checks whether an action is active on a gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param action The id of the action.
+     */
+    bool isActive(SDL_JoystickID device, int action) const;
+
+private:
+    /**
+     * @brief The Compiled struct is the table form of a `GamepadActionMap`.
+     */
+    struct Compiled {
+        /**
+         * @brief The AxisTerm struct is a compiled axis threshold.
+         */
+        struct AxisTerm {
+            Uint8 axis;
+            /// The value that activates the term, always positive.
+            float press;
+            /// The value below which the active term is released.
+            float release;
+            /// Set for thresholds in the negative direction.
+            bool negative;
+        };
+
+        /**
+         * @brief The Term struct is a compiled binding.
+         */
+        struct Term {
+            /// The bitmask of the buttons of the binding.
+            quint32 buttons;
+            /// The bitmask of the axis terms of the binding.
+            quint64 axisTerms;
+            /// The index of the action.
+            int action;
+        };
+
+        QList<AxisTerm> axisTerms;
+        QList<Term> terms;
+        QList<int> ids;
+        QList<QString> names;
+        /// The actions that depend on each button.
+        std::array<quint64, SDL_GAMEPAD_BUTTON_COUNT> buttonActions {};
+        /// The axis terms of each axis.
+        std::array<quint64, SDL_GAMEPAD_AXIS_COUNT> axisTermMasks {};
+        /// The actions that depend on each axis.
+        std::array<quint64, SDL_GAMEPAD_AXIS_COUNT> axisActions {};
+        bool forwardInput = false;
+
+        static std::shared_ptr<const Compiled> compile(const GamepadActionMap& map);
+    };
+
+    /**
+     * @brief The DeviceState struct keeps the inputs and the actions of one gamepad.
+     */
+    struct DeviceState {
+        std::shared_ptr<const Compiled> map;
+        quint32 buttons = 0;
+        std::array<Sint16, SDL_GAMEPAD_AXIS_COUNT> axes {};
+        quint64 axisTerms = 0;
+        quint64 actions = 0;
+    };
+
+    std::shared_ptr<const Compiled> mapOf(SDL_JoystickID device) const;
+
+    /**
+     * @brief Recomputes all axis terms of a gamepad from its axis values.
+     */
+    static void updateAxisTerms(DeviceState& state);
+
+    /**
+     * @brief Re-evaluates the actions of a gamepad selected by @a mask and appends the transitions.
+     */
+    static void evaluate(SDL_JoystickID device, DeviceState& state, quint64 mask,
+                         Uint64 timestamp, QList<Transition>& transitions);
+
+    /**
+     * @brief Appends the transitions of the actions that differ between two states.
+     */
+    static void emitTransitions(SDL_JoystickID device, const Compiled& map, quint64 previous, quint64 current,
+                                Uint64 timestamp, QList<Transition>& transitions);
+
+    std::shared_ptr<const Compiled> _defaultMap = Compiled::compile({});
+    QHash<SDL_JoystickID, std::shared_ptr<const Compiled>> _deviceMaps;
+    QHash<SDL_JoystickID, DeviceState> _devices;
+};
+} // namespace QtSDL
+#endif // GAMEPADACTIONMAPPER_H
@@ -0,0 +1,239 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "gamepadaxisfilter.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QTSDL_AXIS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace QtSDL {
+
+namespace {
+
+constexpr float AXIS_SCALE = 1.0f / 32767.0f;
+
+/**
+ * @brief The smallest stick length used as a divisor.
+ */
+constexpr float MIN_LENGTH = 1e-6f;
+
+bool isTrigger(Uint8 axis) {
+    return axis == SDL_GAMEPAD_AXIS_LEFT_TRIGGER || axis == SDL_GAMEPAD_AXIS_RIGHT_TRIGGER;
+}
+
+/**
+ * @brief Returns the other axis of the same stick.
+ */
+Uint8 partnerAxis(Uint8 axis) {
+    return axis ^ 1;
+}
+}
+
+GamepadAxisFilter::Params GamepadAxisFilter::Params::fromSettings(const Settings &settings) {
+    const float deadzone = std::clamp(settings.deadzone, 0.0f, 1.0f);
+    const float outer = std::clamp(settings.outerDeadzone, deadzone, 1.0f);
+
+    return {deadzone,
+            (outer > deadzone)? 1.0f / (outer - deadzone): 0.0f,
+            std::clamp(settings.curve, 0.0f, 1.0f)};
+}
+
+const GamepadAxisFilter::Settings &GamepadAxisFilter::defaultSettings() const {
+    return _defaultSettings;
+}
+
+void GamepadAxisFilter::setDefaultSettings(const Settings &settings) {
+    _defaultSettings = settings;
+}
+
+void GamepadAxisFilter::setDeviceSettings(const QHash<SDL_JoystickID, Settings> &settings) {
+    _deviceSettings = settings;
+}
+
+void GamepadAxisFilter::removeDevice(SDL_JoystickID device) {
+    _devices.remove(device);
+}
+
+void GamepadAxisFilter::clear() {
+    _devices.clear();
+}
+
+const GamepadAxisFilter::Settings &GamepadAxisFilter::settings(SDL_JoystickID device) const {
+    if (!_deviceSettings.isEmpty()) {
+        auto it = _deviceSettings.constFind(device);
+        if (it != _deviceSettings.constEnd()) {
+            return *it;
+        }
+    }
+
+    return _defaultSettings;
+}
+
+qsizetype GamepadAxisFilter::process(QList<SDL_Event> &events) {
+    _indexes.clear();
+    _x.clear();
+    _y.clear();
+    _deadzone.clear();
+    _invRange.clear();
+    _curve.clear();
+    _hysteresis.clear();
+
+    // Gather the axis samples. The partner axis is taken as it was at the moment of each sample.
+    for (qsizetype index = 0; index < events.size(); ++index) {
+        const SDL_Event& event = events.at(index);
+        if (event.type != SDL_EVENT_GAMEPAD_AXIS_MOTION || event.gaxis.axis >= SDL_GAMEPAD_AXIS_COUNT) {
+            continue;
+        }
+
+        const SDL_GamepadAxisEvent& axis = event.gaxis;
+        DeviceState& state = _devices[axis.which];
+        state.raw[axis.axis] = axis.value;
+
+        const Settings& current = settings(axis.which);
+        const Params params = Params::fromSettings(current);
+        const bool radial = current.mode == DeadzoneMode::Radial && !isTrigger(axis.axis);
+
+        _indexes.append(index);
+        _x.append(axis.value);
+        _y.append((radial)? state.raw[partnerAxis(axis.axis)]: qint16(0));
+        _deadzone.append(params.deadzone);
+        _invRange.append(params.invRange);
+        _curve.append(params.curve);
+        _hysteresis.append(current.hysteresis);
+    }
+
+    if (_indexes.isEmpty()) {
+        return 0;
+    }
+
+    _out.resize(_indexes.size());
+    transform(_x.constData(), _y.constData(), _deadzone.constData(), _invRange.constData(), _curve.constData(),
+              _out.data(), _indexes.size());
+
+    qsizetype dropped = 0;
+    for (qsizetype sample = 0; sample < _indexes.size(); ++sample) {
+        SDL_Event& event = events[_indexes.at(sample)];
+        float& emitted = _devices[event.gaxis.which].emitted[event.gaxis.axis];
+        const float value = _out.at(sample);
+
+        // Reaching the rest position or the end of the range is always reported.
+        const bool edge = (value == 0.0f || std::abs(value) == 1.0f) && value != emitted;
+        if (!edge && std::abs(value - emitted) < _hysteresis.at(sample)) {
+            event.type = SDL_EVENT_FIRST;
+            ++dropped;
+            continue;
+        }
+
+        emitted = value;
+        event.gaxis.value = static_cast<Sint16>(std::lround(value * 32767.0f));
+    }
+
+    return dropped;
+}
+
+void GamepadAxisFilter::transformScalar(const qint16 *x, const qint16 *y,
+                                        const float *deadzone, const float *invRange, const float *curve,
+                                        float *out, qsizetype count) {
+    for (qsizetype i = 0; i < count; ++i) {
+        const float xf = x[i] * AXIS_SCALE;
+        const float yf = y[i] * AXIS_SCALE;
+        const float length = std::sqrt(xf * xf + yf * yf);
+        const float t = std::clamp((length - deadzone[i]) * invRange[i], 0.0f, 1.0f);
+        const float shaped = t + curve[i] * (t * t * t - t);
+        out[i] = std::clamp(xf * (shaped / std::max(length, MIN_LENGTH)), -1.0f, 1.0f);
+    }
+}
+
+void GamepadAxisFilter::transform(const qint16 *x, const qint16 *y,
+                                  const float *deadzone, const float *invRange, const float *curve,
+                                  float *out, qsizetype count) {
+    qsizetype i = 0;
+
+#if defined(__AVX2__)
+    const __m256 scale = _mm256_set1_ps(AXIS_SCALE);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    const __m256 minLength = _mm256_set1_ps(MIN_LENGTH);
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256 xf = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+                              _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)))), scale);
+        const __m256 yf = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+                              _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i)))), scale);
+
+        const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(xf, xf), _mm256_mul_ps(yf, yf)));
+        __m256 t = _mm256_mul_ps(_mm256_sub_ps(length, _mm256_loadu_ps(deadzone + i)), _mm256_loadu_ps(invRange + i));
+        t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+
+        const __m256 cubic = _mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), t);
+        const __m256 shaped = _mm256_add_ps(t, _mm256_mul_ps(_mm256_loadu_ps(curve + i), cubic));
+
+        __m256 result = _mm256_mul_ps(xf, _mm256_div_ps(shaped, _mm256_max_ps(length, minLength)));
+        result = _mm256_min_ps(_mm256_max_ps(result, minusOne), one);
+        _mm256_storeu_ps(out + i, result);
+    }
+#elif defined(QTSDL_AXIS_SSE2)
+    const __m128 scale = _mm_set1_ps(AXIS_SCALE);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    const __m128 minLength = _mm_set1_ps(MIN_LENGTH);
+
+    for (; i + 4 <= count; i += 4) {
+        // Sign-extends four int16 values to int32 by placing them in the high halves and shifting back.
+        const __m128i xi = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(x + i));
+        const __m128i yi = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(y + i));
+        const __m128 xf = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(xi, xi), 16)), scale);
+        const __m128 yf = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(yi, yi), 16)), scale);
+
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(xf, xf), _mm_mul_ps(yf, yf)));
+        __m128 t = _mm_mul_ps(_mm_sub_ps(length, _mm_loadu_ps(deadzone + i)), _mm_loadu_ps(invRange + i));
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+
+        const __m128 cubic = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), t);
+        const __m128 shaped = _mm_add_ps(t, _mm_mul_ps(_mm_loadu_ps(curve + i), cubic));
+
+        __m128 result = _mm_mul_ps(xf, _mm_div_ps(shaped, _mm_max_ps(length, minLength)));
+        result = _mm_min_ps(_mm_max_ps(result, minusOne), one);
+        _mm_storeu_ps(out + i, result);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float32x4_t scale = vdupq_n_f32(AXIS_SCALE);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    const float32x4_t minLength = vdupq_n_f32(MIN_LENGTH);
+
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t xf = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vld1_s16(x + i))), scale);
+        const float32x4_t yf = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vld1_s16(y + i))), scale);
+
+        const float32x4_t length = vsqrtq_f32(vaddq_f32(vmulq_f32(xf, xf), vmulq_f32(yf, yf)));
+        float32x4_t t = vmulq_f32(vsubq_f32(length, vld1q_f32(deadzone + i)), vld1q_f32(invRange + i));
+        t = vminq_f32(vmaxq_f32(t, zero), one);
+
+        const float32x4_t cubic = vsubq_f32(vmulq_f32(vmulq_f32(t, t), t), t);
+        const float32x4_t shaped = vaddq_f32(t, vmulq_f32(vld1q_f32(curve + i), cubic));
+
+        float32x4_t result = vmulq_f32(xf, vdivq_f32(shaped, vmaxq_f32(length, minLength)));
+        result = vminq_f32(vmaxq_f32(result, minusOne), one);
+        vst1q_f32(out + i, result);
+    }
+#endif
+
+    transformScalar(x + i, y + i, deadzone + i, invRange + i, curve + i, out + i, count - i);
+}
+}
@@ -0,0 +1,172 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef GAMEPADAXISFILTER_H
+#define GAMEPADAXISFILTER_H
+
+#include <QHash>
+#include <QList>
+#include <SDL3/SDL.h>
+#include <array>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The GamepadAxisFilter class applies deadzones, response curves and hysteresis to gamepad axis events.
+ *
+ * The filter processes all `SDL_EVENT_GAMEPAD_AXIS_MOTION` events of a polling cycle at once:
+ *
+ * 1. the raw values are gathered into contiguous arrays;
+ * 2. `transform()` converts them to normalized floats and applies the deadzone and the response
+ *    curve with SSE2, AVX2 or NEON instructions, depending on the target, with a scalar fallback;
+ * 3. events whose output changed less than the hysteresis threshold since the last emitted value are dropped,
+ *    and the `value` of the other events is replaced by the filtered value.
+ *
+ * The filter is not thread-safe. It is owned and used by the `SDLEventManager` thread.
+ * @see SDLEventManager::setAxisFilterEnabled
+ */
+class QTSDL_EXPORT GamepadAxisFilter
+{
+public:
+    /**
+     * @brief The DeadzoneMode enum defines how the deadzone of a stick is measured.
+     */
+    enum class DeadzoneMode {
+        /// Each axis is compared with the deadzone separately. The deadzone is a cross.
+        Axial,
+        /// The length of the stick vector is compared with the deadzone. The deadzone is a circle.
+        Radial
+    };
+
+    /**
+     * @brief The Settings struct configures the processing of the axes of one gamepad.
+     *
+     * Triggers always use an axial deadzone.
+     */
+    struct QTSDL_EXPORT Settings {
+        /// How the deadzone of the sticks is measured.
+        DeadzoneMode mode = DeadzoneMode::Radial;
+        /// The normalized input below which the output is 0.
+        float deadzone = 0.1f;
+        /// The normalized input above which the output is 1.
+        float outerDeadzone = 1.0f;
+        /// The response curve: 0 is linear and 1 is cubic. Values in between blend both curves.
+        float curve = 0.0f;
+        /// The minimum change of the normalized output that produces a new event.
+        float hysteresis = 0.01f;
+    };
+
+    /**
+     * @brief The Params struct is the form of `Settings` used by `transform()`.
+     */
+    struct Params {
+        /// The normalized deadzone.
+        float deadzone;
+        /// The inverse of the distance between the deadzone and the outer deadzone.
+        float invRange;
+        /// The weight of the cubic curve.
+        float curve;
+
+        /**
+         * @brief Converts the settings into transform parameters.
+         */
+        static Params fromSettings(const Settings& settings);
+    };
+
+    GamepadAxisFilter() = default;
+
+    /**
+     * @brief Returns the settings used for gamepads without their own settings.
+     */
+    const Settings& defaultSettings() const;
+
+    /**
+     * @brief Sets the settings used for gamepads without their own settings.
+     */
+    void setDefaultSettings(const Settings& settings);
+
+    /**
+     * @brief Replaces the settings of individual gamepads.
+     * @param settings The settings keyed by the SDL joystick instance id.
+     */
+    void setDeviceSettings(const QHash<SDL_JoystickID, Settings>& settings);
+
+    /**
+     * @brief Forgets the state of a disconnected gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     */
+    void removeDevice(SDL_JoystickID device);
+
+    /**
+     * @brief Forgets the state of all gamepads.
+     */
+    void clear();
+
+    /**
+     * @brief Filters the axis events of a polling cycle in place.
+     *
+     * Dropped events get the `SDL_EVENT_FIRST` type and must be removed by the caller.
+     * Events of other types are left untouched.
+     * @param events The events of the cycle.
+     * @return The number of dropped events.
+     */
+    qsizetype process(QList<SDL_Event>& events);
+
+    /**
+     * @brief Converts raw axis values into filtered normalized values.
+     *
+     * For each sample `i` the vector (`x[i]`, `y[i]`) is normalized, its length is mapped through
+     * the deadzone and the response curve, and the filtered `x` component is written to `out[i]`.
+     * Pass `y[i] = 0` for the axial deadzone. The parameters are taken from `Params` arrays
+     * of the same length as the samples.
+     * @param x The raw values of the processed axes.
+     * @param y The raw values of the partner axes of the sticks.
+     * @param deadzone The `Params::deadzone` of each sample.
+     * @param invRange The `Params::invRange` of each sample.
+     * @param curve The `Params::curve` of each sample.
+     * @param out Receives the filtered values in the [-1, 1] range.
+     * @param count The number of samples.
+     */
+    static void transform(const qint16* x, const qint16* y,
+                          const float* deadzone, const float* invRange, const float* curve,
+                          float* out, qsizetype count);
+
+    /**
+     * @brief The scalar implementation of `transform()`, used for the tail of the arrays and on targets without SIMD.
+     */
+    static void transformScalar(const qint16* x, const qint16* y,
+                                const float* deadzone, const float* invRange, const float* curve,
+                                float* out, qsizetype count);
+
+private:
+    /**
+     * @brief The DeviceState struct keeps the axes of one gamepad between cycles.
+     */
+    struct DeviceState {
+        std::array<qint16, SDL_GAMEPAD_AXIS_COUNT> raw {};
+        std::array<float, SDL_GAMEPAD_AXIS_COUNT> emitted {};
+    };
+
+    const Settings& settings(SDL_JoystickID device) const;
+
+    Settings _defaultSettings;
+    QHash<SDL_JoystickID, Settings> _deviceSettings;
+    QHash<SDL_JoystickID, DeviceState> _devices;
+
+    QList<qsizetype> _indexes;
+    QList<qint16> _x;
+    QList<qint16> _y;
+    QList<float> _deadzone;
+    QList<float> _invRange;
+    QList<float> _curve;
+    QList<float> _hysteresis;
+    QList<float> _out;
+};
+} // namespace QtSDL
+#endif // GAMEPADAXISFILTER_H
@@ -0,0 +1,313 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "gamepadorientationfilter.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QTSDL_ORIENTATION_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace QtSDL {
+
+namespace {
+
+/**
+ * @brief The longest gap between two gyroscope samples that is integrated, in seconds.
+ */
+constexpr float MAX_STEP = 0.1f;
+
+/**
+ * @brief The accelerometer samples further than this fraction of gravity from it do not correct the orientation.
+ */
+constexpr float GRAVITY_TOLERANCE = 0.5f;
+
+void normalize(OrientationState& state) {
+    const float norm = std::sqrt(state.w * state.w + state.x * state.x + state.y * state.y + state.z * state.z);
+    if (norm <= 0.0f) {
+        state.w = 1;
+        state.x = state.y = state.z = 0;
+        return;
+    }
+
+    state.w /= norm;
+    state.x /= norm;
+    state.y /= norm;
+    state.z /= norm;
+}
+}
+
+void GamepadOrientationFilter::Samples::append(Uint64 timestamp, const float *data) {
+    timestamps.append(timestamp);
+    x.append(data[0]);
+    y.append(data[1]);
+    z.append(data[2]);
+}
+
+void GamepadOrientationFilter::Samples::clear() {
+    timestamps.clear();
+    x.clear();
+    y.clear();
+    z.clear();
+}
+
+const GamepadOrientationFilter::Settings &GamepadOrientationFilter::settings() const {
+    return _settings;
+}
+
+void GamepadOrientationFilter::setSettings(const Settings &settings) {
+    _settings = settings;
+}
+
+bool GamepadOrientationFilter::push(const SDL_GamepadSensorEvent &event) {
+    if (event.sensor != SDL_SENSOR_GYRO && event.sensor != SDL_SENSOR_ACCEL) {
+        return false;
+    }
+
+    DeviceState& device = _devices[event.which];
+    device.state.device = event.which;
+
+    const Uint64 timestamp = (event.sensor_timestamp)? event.sensor_timestamp: event.timestamp;
+    ((event.sensor == SDL_SENSOR_GYRO)? device.gyro: device.accel).append(timestamp, event.data);
+    return true;
+}
+
+void GamepadOrientationFilter::process() {
+    for (DeviceState& device : _devices) {
+        if (!device.gyro.timestamps.isEmpty() || !device.accel.timestamps.isEmpty()) {
+            processDevice(device);
+        }
+    }
+}
+
+bool GamepadOrientationFilter::hasUpdates() const {
+    return _hasUpdates;
+}
+
+QList<OrientationState> GamepadOrientationFilter::takeUpdates() {
+    QList<OrientationState> updates;
+    if (!_hasUpdates) {
+        return updates;
+    }
+
+    for (DeviceState& device : _devices) {
+        if (device.dirty) {
+            updates.append(device.state);
+            device.dirty = false;
+        }
+    }
+
+    _hasUpdates = false;
+    return updates;
+}
+
+OrientationState GamepadOrientationFilter::orientation(SDL_JoystickID device) const {
+    auto it = _devices.constFind(device);
+    if (it == _devices.constEnd()) {
+        OrientationState state;
+        state.device = device;
+        return state;
+    }
+
+    return it->state;
+}
+
+void GamepadOrientationFilter::removeDevice(SDL_JoystickID device) {
+    _devices.remove(device);
+}
+
+void GamepadOrientationFilter::clear() {
+    _devices.clear();
+    _hasUpdates = false;
+}
+
+void GamepadOrientationFilter::processDevice(DeviceState &device) {
+    Samples& gyro = device.gyro;
+    Samples& accel = device.accel;
+
+    // The magnitudes of the whole batch are computed at once. The bias may change within the batch,
+    // but only slowly, so the bias at the start of the batch is precise enough for the rest detection.
+    gyro.magnitudes.resize(gyro.timestamps.size());
+    magnitudes(gyro.x.constData(), gyro.y.constData(), gyro.z.constData(), device.state.gyroBias,
+               gyro.magnitudes.data(), gyro.timestamps.size());
+    accel.magnitudes.resize(accel.timestamps.size());
+    magnitudes(accel.x.constData(), accel.y.constData(), accel.z.constData(), {},
+               accel.magnitudes.data(), accel.timestamps.size());
+
+    // Both sensors are merged in the order of their timestamps.
+    qsizetype g = 0;
+    qsizetype a = 0;
+    while (g < gyro.timestamps.size() || a < accel.timestamps.size()) {
+        if (a < accel.timestamps.size() &&
+            (g >= gyro.timestamps.size() || accel.timestamps[a] <= gyro.timestamps[g])) {
+            applyAccel(device, a++);
+        } else {
+            applyGyro(device, g++);
+        }
+    }
+
+    gyro.clear();
+    accel.clear();
+    device.dirty = true;
+    _hasUpdates = true;
+}
+
+void GamepadOrientationFilter::applyAccel(DeviceState &device, qsizetype index) {
+    const Samples& accel = device.accel;
+    const float magnitude = accel.magnitudes[index];
+
+    device.gravityValid = magnitude > 0.0f && std::abs(magnitude - GRAVITY) < GRAVITY * GRAVITY_TOLERANCE;
+    if (!device.gravityValid) {
+        device.state.atRest = false;
+        device.restElapsed = 0;
+        return;
+    }
+
+    device.gravity = {accel.x[index] / magnitude, accel.y[index] / magnitude, accel.z[index] / magnitude};
+    if (std::abs(magnitude - GRAVITY) > _settings.restAccelThreshold) {
+        device.state.atRest = false;
+        device.restElapsed = 0;
+    }
+
+    if (device.aligned) {
+        return;
+    }
+
+    // The first orientation is the rotation of the measured up direction onto the world up axis (0, 1, 0).
+    OrientationState& q = device.state;
+    const auto& up = device.gravity;
+    q.w = 1.0f + up[1];
+    q.x = -up[2];
+    q.y = 0.0f;
+    q.z = up[0];
+    if (q.w < 1e-6f) {
+        q.w = 0;
+        q.x = 1;
+        q.z = 0;
+    }
+    normalize(q);
+
+    device.aligned = true;
+    device.state.timestamp = accel.timestamps[index];
+}
+
+void GamepadOrientationFilter::applyGyro(DeviceState &device, qsizetype index) {
+    const Samples& gyro = device.gyro;
+    const Uint64 timestamp = gyro.timestamps[index];
+    const Uint64 previous = device.lastGyro;
+    device.lastGyro = timestamp;
+    device.state.timestamp = timestamp;
+
+    if (!previous || timestamp <= previous) {
+        return;
+    }
+
+    const float dt = std::min(static_cast<float>(timestamp - previous) / SDL_NS_PER_SECOND, MAX_STEP);
+    OrientationState& q = device.state;
+    std::array<float, 3>& bias = q.gyroBias;
+
+    // Rest detection and bias estimation.
+    if (device.gravityValid && gyro.magnitudes[index] < _settings.restGyroThreshold) {
+        device.restElapsed += dt;
+    } else {
+        device.restElapsed = 0;
+    }
+
+    q.atRest = device.restElapsed >= _settings.restTime;
+    if (q.atRest && _settings.calibrateAtRest) {
+        const float alpha = dt / (dt + std::max(_settings.biasTimeConstant, 1e-3f));
+        bias[0] += alpha * (gyro.x[index] - bias[0]);
+        bias[1] += alpha * (gyro.y[index] - bias[1]);
+        bias[2] += alpha * (gyro.z[index] - bias[2]);
+        q.calibrated = true;
+    }
+
+    float gx = gyro.x[index] - bias[0];
+    float gy = gyro.y[index] - bias[1];
+    float gz = gyro.z[index] - bias[2];
+
+    // The error between the measured and the estimated up direction rotates the gyroscope towards gravity.
+    if (device.gravityValid) {
+        const float vx = 2.0f * (q.x * q.y + q.w * q.z);
+        const float vy = 1.0f - 2.0f * (q.x * q.x + q.z * q.z);
+        const float vz = 2.0f * (q.y * q.z - q.w * q.x);
+
+        const auto& a = device.gravity;
+        const float ex = a[1] * vz - a[2] * vy;
+        const float ey = a[2] * vx - a[0] * vz;
+        const float ez = a[0] * vy - a[1] * vx;
+
+        if (_settings.integralGain > 0.0f) {
+            device.integral[0] += _settings.integralGain * ex * dt;
+            device.integral[1] += _settings.integralGain * ey * dt;
+            device.integral[2] += _settings.integralGain * ez * dt;
+        }
+
+        gx += _settings.gain * ex + device.integral[0];
+        gy += _settings.gain * ey + device.integral[1];
+        gz += _settings.gain * ez + device.integral[2];
+    }
+
+    const float half = 0.5f * dt;
+    const float w = q.w;
+    const float x = q.x;
+    const float y = q.y;
+    const float z = q.z;
+    q.w += half * (-x * gx - y * gy - z * gz);
+    q.x += half * (w * gx + y * gz - z * gy);
+    q.y += half * (w * gy - x * gz + z * gx);
+    q.z += half * (w * gz + x * gy - y * gx);
+    normalize(q);
+}
+
+void GamepadOrientationFilter::magnitudesScalar(const float *x, const float *y, const float *z,
+                                                const std::array<float, 3> &offset, float *out, qsizetype count) {
+    for (qsizetype i = 0; i < count; ++i) {
+        const float dx = x[i] - offset[0];
+        const float dy = y[i] - offset[1];
+        const float dz = z[i] - offset[2];
+        out[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+void GamepadOrientationFilter::magnitudes(const float *x, const float *y, const float *z,
+                                          const std::array<float, 3> &offset, float *out, qsizetype count) {
+    qsizetype i = 0;
+
+#if defined(QTSDL_ORIENTATION_SSE2)
+    const __m128 ox = _mm_set1_ps(offset[0]);
+    const __m128 oy = _mm_set1_ps(offset[1]);
+    const __m128 oz = _mm_set1_ps(offset[2]);
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), ox);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), oy);
+        const __m128 dz = _mm_sub_ps(_mm_loadu_ps(z + i), oz);
+        const __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(squared));
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float32x4_t ox = vdupq_n_f32(offset[0]);
+    const float32x4_t oy = vdupq_n_f32(offset[1]);
+    const float32x4_t oz = vdupq_n_f32(offset[2]);
+
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t dx = vsubq_f32(vld1q_f32(x + i), ox);
+        const float32x4_t dy = vsubq_f32(vld1q_f32(y + i), oy);
+        const float32x4_t dz = vsubq_f32(vld1q_f32(z + i), oz);
+        const float32x4_t squared = vaddq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(dz, dz));
+        vst1q_f32(out + i, vsqrtq_f32(squared));
+    }
+#endif
+
+    magnitudesScalar(x + i, y + i, z + i, offset, out + i, count - i);
+}
+}
@@ -0,0 +1,208 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef GAMEPADORIENTATIONFILTER_H
+#define GAMEPADORIENTATIONFILTER_H
+
+#include <QHash>
+#include <QList>
+#include <SDL3/SDL.h>
+#include <array>
+#include "deviceslot.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The OrientationState struct is the fused orientation of one gamepad.
+ *
+ * The orientation is a unit quaternion that rotates vectors from the gamepad frame of SDL
+ * (X to the right, Y up, Z towards the player) to a world frame whose Y axis points up.
+ * The heading drifts slowly, because the accelerometer only corrects the pitch and the roll.
+ */
+struct QTSDL_EXPORT OrientationState {
+    /// The SDL joystick instance id of the gamepad.
+    SDL_JoystickID device = 0;
+    /// The slot of the gamepad.
+    DeviceSlot slot;
+    /// The sensor timestamp (in nanoseconds) of the last fused sample.
+    Uint64 timestamp = 0;
+    /// The scalar part of the quaternion.
+    float w = 1;
+    /// The X component of the vector part of the quaternion.
+    float x = 0;
+    /// The Y component of the vector part of the quaternion.
+    float y = 0;
+    /// The Z component of the vector part of the quaternion.
+    float z = 0;
+    /// The estimated gyroscope bias in radians per second, subtracted from the gyroscope samples.
+    std::array<float, 3> gyroBias {};
+    /// Set while the gamepad is at rest.
+    bool atRest = false;
+    /// Set once the gyroscope bias was estimated during a rest period.
+    bool calibrated = false;
+};
+
+/**
+ * @brief The GamepadOrientationFilter class fuses gyroscope and accelerometer samples into orientations.
+ *
+ * The filter is a Mahony complementary filter: the gyroscope samples are integrated into a quaternion
+ * per gamepad, and the direction of gravity measured by the accelerometer corrects the drift of the pitch
+ * and the roll with a proportional and an optional integral gain. While the gamepad rests, the gyroscope
+ * bias is estimated and subtracted.
+ *
+ * The samples of a polling cycle are gathered into per-device arrays by `push()` and fused by `process()`.
+ * The magnitudes used by the rest detection are computed for the whole batch at once with SSE2 or NEON
+ * instructions, depending on the target, with a scalar fallback. The integration itself is sequential.
+ *
+ * The filter is not thread-safe. It is owned and used by the `SDLEventManager` thread.
+ * @see SDLEventManager::setOrientationFusion
+ */
+class QTSDL_EXPORT GamepadOrientationFilter
+{
+public:
+    /// The standard gravity in meters per second squared.
+    static constexpr float GRAVITY = 9.80665f;
+
+    /**
+     * @brief The Settings struct configures the fusion.
+     */
+    struct QTSDL_EXPORT Settings {
+        /// The proportional gain of the accelerometer correction. Higher values trust the accelerometer more.
+        float gain = 0.5f;
+        /// The integral gain of the accelerometer correction. 0 disables the integral term.
+        float integralGain = 0.0f;
+        /// Enables the estimation of the gyroscope bias while the gamepad rests.
+        bool calibrateAtRest = true;
+        /// The largest rotation speed in radians per second at which the gamepad is considered resting.
+        float restGyroThreshold = 0.05f;
+        /// The largest deviation of the acceleration from gravity in meters per second squared at rest.
+        float restAccelThreshold = 0.4f;
+        /// The time in seconds the gamepad must rest before the bias is estimated.
+        float restTime = 0.5f;
+        /// The time constant in seconds of the bias estimation.
+        float biasTimeConstant = 1.0f;
+    };
+
+    GamepadOrientationFilter() = default;
+
+    /**
+     * @brief Returns the settings of the fusion.
+     */
+    const Settings& settings() const;
+
+    /**
+     * @brief Sets the settings of the fusion.
+     */
+    void setSettings(const Settings& settings);
+
+    /**
+     * @brief Appends a gyroscope or accelerometer sample to the batch of its gamepad.
+     * @param event The `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` event.
+     * @return true if the sample is used by the fusion.
+     */
+    bool push(const SDL_GamepadSensorEvent& event);
+
+    /**
+     * @brief Fuses the samples gathered since the previous call.
+     */
+    void process();
+
+    /**
+     * @brief Checks whether orientations changed since the previous `takeUpdates()`.
+     */
+    bool hasUpdates() const;
+
+    /**
+     * @brief Returns the orientations of the gamepads that changed since the previous call.
+     */
+    QList<OrientationState> takeUpdates();
+
+    /**
+     * @brief Returns the current orientation of a gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @return The orientation, or an identity orientation if the gamepad has no samples.
+     */
+    OrientationState orientation(SDL_JoystickID device) const;
+
+    /**
+     * @brief Forgets a disconnected gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     */
+    void removeDevice(SDL_JoystickID device);
+
+    /**
+     * @brief Forgets all gamepads.
+     */
+    void clear();
+
+    /**
+     * @brief Computes the lengths of the vectors (`x[i]` - `offset[0]`, `y[i]` - `offset[1]`, `z[i]` - `offset[2]`).
+     * @param x The X components.
+     * @param y The Y components.
+     * @param z The Z components.
+     * @param offset The vector subtracted from each sample.
+     * @param out Receives the lengths.
+     * @param count The number of samples.
+     */
+    static void magnitudes(const float* x, const float* y, const float* z, const std::array<float, 3>& offset,
+                           float* out, qsizetype count);
+
+    /**
+     * @brief The scalar implementation of `magnitudes()`, used for the tail of the arrays and on targets without SIMD.
+     */
+    static void magnitudesScalar(const float* x, const float* y, const float* z, const std::array<float, 3>& offset,
+                                 float* out, qsizetype count);
+
+private:
+    /**
+     * @brief The Samples struct is a batch of samples of one sensor as a structure of arrays.
+     */
+    struct Samples {
+        QList<Uint64> timestamps;
+        QList<float> x;
+        QList<float> y;
+        QList<float> z;
+        QList<float> magnitudes;
+
+        void append(Uint64 timestamp, const float* data);
+        void clear();
+    };
+
+    /**
+     * @brief The DeviceState struct keeps the fusion state of one gamepad between cycles.
+     */
+    struct DeviceState {
+        OrientationState state;
+        Samples gyro;
+        Samples accel;
+        /// The last accelerometer sample, normalized, and whether it is close to gravity.
+        std::array<float, 3> gravity {};
+        bool gravityValid = false;
+        /// Set once the quaternion was aligned with the first accelerometer sample.
+        bool aligned = false;
+        /// The integral term of the correction.
+        std::array<float, 3> integral {};
+        /// The time the gamepad has been resting, in seconds.
+        float restElapsed = 0;
+        /// The timestamp of the last gyroscope sample.
+        Uint64 lastGyro = 0;
+        /// Set when the state changed since the previous `takeUpdates()`.
+        bool dirty = false;
+    };
+
+    void processDevice(DeviceState& device);
+    void applyAccel(DeviceState& device, qsizetype index);
+    void applyGyro(DeviceState& device, qsizetype index);
+
+    Settings _settings;
+    QHash<SDL_JoystickID, DeviceState> _devices;
+    bool _hasUpdates = false;
+};
+} // namespace QtSDL
+#endif // GAMEPADORIENTATIONFILTER_H
@@ -0,0 +1,85 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "gamepadsensorbuffer.h"
+#include <algorithm>
+
+namespace QtSDL {
+
+GamepadSensorBuffer::GamepadSensorBuffer(qsizetype capacity) {
+    capacity = std::max<qsizetype>(capacity, 1);
+    _timestamps.resize(capacity);
+    _x.resize(capacity);
+    _y.resize(capacity);
+    _z.resize(capacity);
+}
+
+void GamepadSensorBuffer::push(Uint64 timestamp, float x, float y, float z) {
+    const qsizetype capacity = _timestamps.size();
+    qsizetype tail = _head + _size;
+    if (tail >= capacity) {
+        tail -= capacity;
+    }
+
+    _timestamps[tail] = timestamp;
+    _x[tail] = x;
+    _y[tail] = y;
+    _z[tail] = z;
+
+    if (_size < capacity) {
+        ++_size;
+        return;
+    }
+
+    // The buffer is full, the oldest sample was overwritten.
+    _head = (_head + 1 == capacity)? 0 : _head + 1;
+    ++_dropped;
+}
+
+template<class T>
+void GamepadSensorBuffer::copyOrdered(const QList<T> &source, QList<T> &destination) const {
+    const qsizetype capacity = source.size();
+    const qsizetype firstPart = std::min(_size, capacity - _head);
+
+    destination.resize(_size);
+    std::copy_n(source.constData() + _head, firstPart, destination.data());
+    std::copy_n(source.constData(), _size - firstPart, destination.data() + firstPart);
+}
+
+quint64 GamepadSensorBuffer::takeBlock(QList<Uint64> &timestamps, QList<float> &x, QList<float> &y, QList<float> &z) {
+    copyOrdered(_timestamps, timestamps);
+    copyOrdered(_x, x);
+    copyOrdered(_y, y);
+    copyOrdered(_z, z);
+
+    const quint64 dropped = _dropped;
+    clear();
+    return dropped;
+}
+
+void GamepadSensorBuffer::clear() {
+    _head = 0;
+    _size = 0;
+    _dropped = 0;
+}
+
+qsizetype GamepadSensorBuffer::size() const {
+    return _size;
+}
+
+bool GamepadSensorBuffer::isEmpty() const {
+    return !_size;
+}
+
+qsizetype GamepadSensorBuffer::capacity() const {
+    return _timestamps.size();
+}
+
+quint64 GamepadSensorBuffer::dropped() const {
+    return _dropped;
+}
+}
@@ -0,0 +1,93 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef GAMEPADSENSORBUFFER_H
+#define GAMEPADSENSORBUFFER_H
+
+#include <QList>
+#include <SDL3/SDL.h>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The GamepadSensorBuffer class is a fixed-size ring buffer of sensor samples of one gamepad sensor.
+ *
+ * Samples are stored as a structure of arrays (timestamps, x, y and z), so a block of samples
+ * can be copied out with a few contiguous copies. When the buffer is full the oldest sample is
+ * overwritten and counted in `dropped()`.
+ *
+ * The buffer is not thread-safe. It is owned and used by the `SDLEventManager` thread.
+ */
+class QTSDL_EXPORT GamepadSensorBuffer
+{
+public:
+    /**
+     * @brief Constructs an empty buffer.
+     * @param capacity The maximum number of stored samples.
+     */
+    explicit GamepadSensorBuffer(qsizetype capacity = 256);
+
+    /**
+     * @brief Appends a sample to the buffer, overwriting the oldest one if the buffer is full.
+     * @param timestamp The timestamp of the sample in nanoseconds.
+     * @param x The first value of the sample.
+     * @param y The second value of the sample.
+     * @param z The third value of the sample.
+     */
+    void push(Uint64 timestamp, float x, float y, float z);
+
+    /**
+     * @brief Moves all stored samples into the output arrays in the order of arrival and clears the buffer.
+     * @param timestamps Receives the timestamps of the samples.
+     * @param x Receives the first values of the samples.
+     * @param y Receives the second values of the samples.
+     * @param z Receives the third values of the samples.
+     * @return The number of samples dropped since the previous call.
+     */
+    quint64 takeBlock(QList<Uint64>& timestamps, QList<float>& x, QList<float>& y, QList<float>& z);
+
+    /**
+     * @brief Removes all samples from the buffer.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of stored samples.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Checks whether the buffer is empty.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Returns the maximum number of stored samples.
+     */
+    qsizetype capacity() const;
+
+    /**
+     * @brief Returns the number of samples overwritten since the last `takeBlock()` call.
+     */
+    quint64 dropped() const;
+
+private:
+    template<class T>
+    void copyOrdered(const QList<T>& source, QList<T>& destination) const;
+
+    QList<Uint64> _timestamps;
+    QList<float> _x;
+    QList<float> _y;
+    QList<float> _z;
+    qsizetype _head = 0;
+    qsizetype _size = 0;
+    quint64 _dropped = 0;
+};
+} // namespace QtSDL
+#endif // GAMEPADSENSORBUFFER_H
@@ -0,0 +1,206 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "gamepadstatecache.h"
+#include <bit>
+#include <cstring>
+
+namespace QtSDL {
+
+static_assert(GamepadStateCache::MAX_DEVICES <= 32, "The dirty mask of GamepadStateCache holds 32 devices");
+
+GamepadStateCache::GamepadStateCache() {}
+
+bool GamepadStateCache::snapshot(SDL_JoystickID device, GamepadState &state) const {
+    if (!device) {
+        return false;
+    }
+
+    for (const Slot& slot: _slots) {
+        if (slot.device.load(std::memory_order_acquire) != device) {
+            continue;
+        }
+
+        quint32 before = 0;
+        quint32 after = 0;
+        do {
+            before = slot.sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                // The writer is updating the slot right now.
+                continue;
+            }
+
+            std::memcpy(&state, &slot.state, sizeof(GamepadState));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = slot.sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+
+        // The slot may have been reused by another gamepad while we were reading it.
+        return state.device == device;
+    }
+
+    return false;
+}
+
+QList<SDL_JoystickID> GamepadStateCache::devices() const {
+    QList<SDL_JoystickID> result;
+    for (const Slot& slot: _slots) {
+        if (auto device = slot.device.load(std::memory_order_acquire)) {
+            result.append(device);
+        }
+    }
+
+    return result;
+}
+
+bool GamepadStateCache::addDevice(SDL_JoystickID device, SDL_Gamepad *gamepad) {
+    int index = findWorking(device);
+    if (index < 0) {
+        index = findWorking(0);
+    }
+
+    if (index < 0) {
+        return false;
+    }
+
+    GamepadState& state = _working[index];
+    state = GamepadState{};
+    state.device = device;
+
+    if (gamepad) {
+        for (int button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; ++button) {
+            if (SDL_GetGamepadButton(gamepad, static_cast<SDL_GamepadButton>(button))) {
+                state.buttons |= quint64(1) << button;
+            }
+        }
+
+        for (int axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; ++axis) {
+            state.axes[axis] = SDL_GetGamepadAxis(gamepad, static_cast<SDL_GamepadAxis>(axis));
+        }
+    }
+
+    write(index);
+    _slots[index].device.store(device, std::memory_order_release);
+    return true;
+}
+
+void GamepadStateCache::removeDevice(SDL_JoystickID device) {
+    const int index = findWorking(device);
+    if (index < 0) {
+        return;
+    }
+
+    _slots[index].device.store(0, std::memory_order_release);
+    _working[index] = GamepadState{};
+    write(index);
+    _dirty &= ~(quint32(1) << index);
+}
+
+void GamepadStateCache::update(const SDL_Event &event) {
+    if (event.type < SDL_EVENT_GAMEPAD_AXIS_MOTION || event.type > SDL_EVENT_GAMEPAD_SENSOR_UPDATE) {
+        return;
+    }
+
+    const int index = findWorking(event.gdevice.which);
+    if (index < 0) {
+        return;
+    }
+
+    GamepadState& state = _working[index];
+
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        if (event.gaxis.axis < SDL_GAMEPAD_AXIS_COUNT) {
+            state.axes[event.gaxis.axis] = event.gaxis.value;
+        }
+        break;
+
+    case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+    case SDL_EVENT_GAMEPAD_BUTTON_UP:
+        if (event.gbutton.button < 64) {
+            const quint64 mask = quint64(1) << event.gbutton.button;
+            state.buttons = (event.gbutton.down)? (state.buttons | mask): (state.buttons & ~mask);
+        }
+        break;
+
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_UP: {
+        const auto& touch = event.gtouchpad;
+        if (touch.touchpad < 0 || touch.touchpad >= GamepadState::MAX_TOUCHPADS ||
+            touch.finger < 0 || touch.finger >= GamepadState::MAX_FINGERS) {
+            return;
+        }
+
+        GamepadTouchFinger& finger = state.fingers[touch.touchpad][touch.finger];
+        finger.down = event.type != SDL_EVENT_GAMEPAD_TOUCHPAD_UP;
+        finger.x = touch.x;
+        finger.y = touch.y;
+        finger.pressure = touch.pressure;
+        break;
+    }
+
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE: {
+        const auto& sensor = event.gsensor;
+        if (sensor.sensor == SDL_SENSOR_ACCEL) {
+            std::memcpy(state.accel.data(), sensor.data, sizeof(float) * 3);
+            state.accelTimestamp = (sensor.sensor_timestamp)? sensor.sensor_timestamp: sensor.timestamp;
+        } else if (sensor.sensor == SDL_SENSOR_GYRO) {
+            std::memcpy(state.gyro.data(), sensor.data, sizeof(float) * 3);
+            state.gyroTimestamp = (sensor.sensor_timestamp)? sensor.sensor_timestamp: sensor.timestamp;
+        } else {
+            return;
+        }
+        break;
+    }
+
+    default:
+        return;
+    }
+
+    state.timestamp = event.common.timestamp;
+    _dirty |= quint32(1) << index;
+}
+
+void GamepadStateCache::publish() {
+    while (_dirty) {
+        const int index = std::countr_zero(_dirty);
+        _dirty &= _dirty - 1;
+        write(index);
+    }
+}
+
+void GamepadStateCache::clear() {
+    for (int index = 0; index < MAX_DEVICES; ++index) {
+        if (_working[index].device) {
+            removeDevice(_working[index].device);
+        }
+    }
+}
+
+int GamepadStateCache::findWorking(SDL_JoystickID device) const {
+    for (int index = 0; index < MAX_DEVICES; ++index) {
+        if (_working[index].device == device) {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+void GamepadStateCache::write(int index) {
+    Slot& slot = _slots[index];
+    const quint32 sequence = slot.sequence.load(std::memory_order_relaxed);
+
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(&slot.state, &_working[index], sizeof(GamepadState));
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+}
@@ -0,0 +1,165 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef GAMEPADSTATECACHE_H
+#define GAMEPADSTATECACHE_H
+
+#include <QList>
+#include <SDL3/SDL.h>
+#include <array>
+#include <atomic>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The GamepadTouchFinger struct describes the state of one finger on a gamepad touchpad.
+ */
+struct GamepadTouchFinger {
+    /// true while the finger touches the touchpad.
+    bool down = false;
+    /// The normalized X position of the finger, from 0 (left) to 1 (right).
+    float x = 0;
+    /// The normalized Y position of the finger, from 0 (top) to 1 (bottom).
+    float y = 0;
+    /// The normalized pressure of the finger.
+    float pressure = 0;
+};
+
+/**
+ * @brief The GamepadState struct is a plain snapshot of the state of one gamepad.
+ */
+struct GamepadState {
+    /// The maximum number of touchpads stored in the snapshot.
+    static constexpr int MAX_TOUCHPADS = 2;
+    /// The maximum number of fingers stored per touchpad.
+    static constexpr int MAX_FINGERS = 4;
+
+    /// The SDL joystick instance id of the gamepad.
+    SDL_JoystickID device = 0;
+    /// The SDL timestamp (in nanoseconds) of the last event applied to the state.
+    Uint64 timestamp = 0;
+    /// The bitmask of pressed buttons, the bit N corresponds to the `SDL_GamepadButton` N.
+    quint64 buttons = 0;
+    /// The raw values of all axes, indexed by `SDL_GamepadAxis`.
+    std::array<Sint16, SDL_GAMEPAD_AXIS_COUNT> axes {};
+    /// The touchpad fingers, indexed by touchpad and finger.
+    std::array<std::array<GamepadTouchFinger, MAX_FINGERS>, MAX_TOUCHPADS> fingers {};
+    /// The latest accelerometer sample in m/s^2.
+    std::array<float, 3> accel {};
+    /// The latest gyroscope sample in rad/s.
+    std::array<float, 3> gyro {};
+    /// The timestamp of the latest accelerometer sample.
+    Uint64 accelTimestamp = 0;
+    /// The timestamp of the latest gyroscope sample.
+    Uint64 gyroTimestamp = 0;
+
+    /**
+     * @brief Checks whether the button is pressed.
+     * @param button The gamepad button.
+     * @return true if the button is pressed.
+     */
+    bool isPressed(SDL_GamepadButton button) const {
+        return button >= 0 && button < 64 && (buttons & (quint64(1) << button));
+    }
+
+    /**
+     * @brief Returns the raw value of the axis.
+     * @param axis The gamepad axis.
+     * @return The axis value in the range [-32768, 32767], 0 for an invalid axis.
+     */
+    Sint16 axis(SDL_GamepadAxis axis) const {
+        return (axis >= 0 && axis < SDL_GAMEPAD_AXIS_COUNT)? axes[axis]: 0;
+    }
+};
+
+/**
+ * @brief The GamepadStateCache class keeps the current state of every gamepad opened by `SDLEventManager`.
+ *
+ * The manager applies each gamepad event to a private working copy of the state and publishes
+ * the changed devices once per polling cycle. Each device is published through a seqlock, so
+ * `snapshot()` may be called from any thread (game loop, render thread, ...) and always returns
+ * a consistent state without locks or posted events.
+ *
+ * Devices are keyed by the same SDL joystick instance ids that the manager uses.
+ * Up to `MAX_DEVICES` gamepads are tracked at the same time.
+ *
+ * @note Only `snapshot()` and `devices()` are thread-safe. All other methods are called by the manager thread.
+ */
+class QTSDL_EXPORT GamepadStateCache
+{
+public:
+    /// The maximum number of tracked gamepads.
+    static constexpr int MAX_DEVICES = 16;
+
+    GamepadStateCache();
+    GamepadStateCache(const GamepadStateCache&) = delete;
+    GamepadStateCache& operator=(const GamepadStateCache&) = delete;
+
+    /**
+     * @brief Reads a consistent snapshot of the gamepad state. This method is lock-free and may be called from any thread.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param state Receives the state of the gamepad.
+     * @return true if the gamepad is tracked by the cache.
+     */
+    bool snapshot(SDL_JoystickID device, GamepadState& state) const;
+
+    /**
+     * @brief Returns the ids of all tracked gamepads. This method may be called from any thread.
+     * @return The list of SDL joystick instance ids.
+     */
+    QList<SDL_JoystickID> devices() const;
+
+    /**
+     * @brief Starts tracking a gamepad and reads its initial state.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param gamepad The opened gamepad handle, may be nullptr.
+     * @return true if a free slot was found.
+     */
+    bool addDevice(SDL_JoystickID device, SDL_Gamepad* gamepad);
+
+    /**
+     * @brief Stops tracking a gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     */
+    void removeDevice(SDL_JoystickID device);
+
+    /**
+     * @brief Applies a gamepad event to the working copy of its device state.
+     *
+     * The change is visible to readers after the next `publish()` call.
+     * @param event The SDL event. Events that are not related to tracked gamepads are ignored.
+     */
+    void update(const SDL_Event& event);
+
+    /**
+     * @brief Publishes the working copies of all changed devices to the readers.
+     */
+    void publish();
+
+    /**
+     * @brief Stops tracking all gamepads.
+     */
+    void clear();
+
+private:
+    struct Slot {
+        std::atomic<SDL_JoystickID> device {0};
+        std::atomic<quint32> sequence {0};
+        GamepadState state;
+    };
+
+    int findWorking(SDL_JoystickID device) const;
+    void write(int index);
+
+    std::array<Slot, MAX_DEVICES> _slots;
+    std::array<GamepadState, MAX_DEVICES> _working;
+    quint32 _dirty = 0;
+};
+} // namespace QtSDL
+#endif // GAMEPADSTATECACHE_H
@@ -0,0 +1,167 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "gamepadtouchpadtracker.h"
+
+namespace QtSDL {
+
+namespace {
+
+bool isClose(const TouchpadTrajectory::Point& left, const TouchpadTrajectory::Point& right) {
+    const float dx = left.x - right.x;
+    const float dy = left.y - right.y;
+    return dx * dx + dy * dy < GamepadTouchpadTracker::MIN_DISTANCE * GamepadTouchpadTracker::MIN_DISTANCE;
+}
+}
+
+bool GamepadTouchpadTracker::process(const SDL_Event &event) {
+    if (event.type != SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN && event.type != SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION &&
+        event.type != SDL_EVENT_GAMEPAD_TOUCHPAD_UP) {
+        return false;
+    }
+
+    const SDL_GamepadTouchpadEvent& touch = event.gtouchpad;
+    const quint64 fingerKey = key(touch.which, touch.touchpad, touch.finger);
+    const TouchpadTrajectory::Point point {touch.timestamp, touch.x, touch.y, touch.pressure};
+
+    auto it = _fingers.find(fingerKey);
+    if (event.type == SDL_EVENT_GAMEPAD_TOUCHPAD_UP) {
+        if (it == _fingers.end()) {
+            return true;
+        }
+
+        addPoint(fingerKey, it.value(), point, true);
+        it->trajectory.ended = true;
+        finish(fingerKey, it.value());
+        _fingers.erase(it);
+        return true;
+    }
+
+    if (it != _fingers.end() && event.type == SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN) {
+        // The lift of the previous touch was lost.
+        it->trajectory.ended = true;
+        finish(fingerKey, it.value());
+        _fingers.erase(it);
+        it = _fingers.end();
+    }
+
+    if (it == _fingers.end()) {
+        // A motion of an unknown finger, for example after the tracking was enabled, starts without a touch.
+        Finger finger;
+        finger.trajectory.device = touch.which;
+        finger.trajectory.touchpad = touch.touchpad;
+        finger.trajectory.finger = touch.finger;
+        finger.trajectory.began = event.type == SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN;
+        finger.last = point;
+        finger.anchor = point;
+
+        it = _fingers.insert(fingerKey, finger);
+        addPoint(fingerKey, it.value(), point, true);
+        return true;
+    }
+
+    addPoint(fingerKey, it.value(), point, false);
+    return true;
+}
+
+void GamepadTouchpadTracker::removeDevice(SDL_JoystickID device, Uint64 timestamp) {
+    for (auto it = _fingers.begin(); it != _fingers.end();) {
+        if (it->trajectory.device != device) {
+            ++it;
+            continue;
+        }
+
+        TouchpadTrajectory::Point point = it->last;
+        point.timestamp = timestamp;
+        point.pressure = 0;
+        addPoint(it.key(), it.value(), point, true);
+        it->trajectory.ended = true;
+        finish(it.key(), it.value());
+        it = _fingers.erase(it);
+    }
+}
+
+void GamepadTouchpadTracker::clear() {
+    _fingers.clear();
+    _dirty.clear();
+    _completed.clear();
+}
+
+bool GamepadTouchpadTracker::hasPending() const {
+    return !_dirty.isEmpty() || !_completed.isEmpty();
+}
+
+QList<TouchpadTrajectory> GamepadTouchpadTracker::takeTrajectories() {
+    QList<TouchpadTrajectory> result = std::move(_completed);
+    _completed.clear();
+
+    for (quint64 fingerKey : std::as_const(_dirty)) {
+        Finger& finger = _fingers[fingerKey];
+        result.append(finger.trajectory);
+
+        finger.trajectory.points.clear();
+        finger.trajectory.began = false;
+        finger.dirty = false;
+        finger.tailPending = false;
+    }
+
+    _dirty.clear();
+    return result;
+}
+
+quint64 GamepadTouchpadTracker::key(SDL_JoystickID device, int touchpad, int finger) {
+    return (static_cast<quint64>(device) << 32) | (static_cast<quint64>(touchpad & 0xFFFF) << 16) |
+           static_cast<quint64>(finger & 0xFFFF);
+}
+
+void GamepadTouchpadTracker::addPoint(quint64 key, Finger &finger, const TouchpadTrajectory::Point &point, bool force) {
+    TouchpadTrajectory& trajectory = finger.trajectory;
+
+    // Exponential smoothing with a fixed time constant works with any sample rate.
+    if (point.timestamp > finger.last.timestamp) {
+        const float dt = static_cast<float>(point.timestamp - finger.last.timestamp) / SDL_NS_PER_SECOND;
+        const float alpha = dt / (dt + VELOCITY_TIME_CONSTANT);
+        trajectory.velocityX += alpha * ((point.x - finger.last.x) / dt - trajectory.velocityX);
+        trajectory.velocityY += alpha * ((point.y - finger.last.y) / dt - trajectory.velocityY);
+    }
+    finger.last = point;
+
+    if (!finger.dirty) {
+        finger.dirty = true;
+        _dirty.append(key);
+    }
+
+    auto& points = trajectory.points;
+    if (force || !isClose(point, finger.anchor)) {
+        // A pending tail is close to the anchor, so the new point replaces it.
+        if (finger.tailPending) {
+            points.last() = point;
+        } else {
+            points.append(point);
+        }
+
+        finger.anchor = point;
+        finger.tailPending = false;
+        return;
+    }
+
+    // The latest sample is always the last point, even when it moved less than the minimal distance.
+    if (finger.tailPending) {
+        points.last() = point;
+    } else {
+        points.append(point);
+        finger.tailPending = true;
+    }
+}
+
+void GamepadTouchpadTracker::finish(quint64 key, Finger &finger) {
+    _completed.append(finger.trajectory);
+    if (finger.dirty) {
+        _dirty.removeOne(key);
+    }
+}
+}
@@ -0,0 +1,154 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef GAMEPADTOUCHPADTRACKER_H
+#define GAMEPADTOUCHPADTRACKER_H
+
+#include <QHash>
+#include <QList>
+#include <QVarLengthArray>
+#include <SDL3/SDL.h>
+#include "deviceslot.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The TouchpadTrajectory struct is the path of one finger on a gamepad touchpad during one polling cycle.
+ */
+struct QTSDL_EXPORT TouchpadTrajectory {
+    /**
+     * @brief The Point struct is a sample of the finger position.
+     */
+    struct Point {
+        /// The SDL timestamp of the sample in nanoseconds.
+        Uint64 timestamp = 0;
+        /// The normalized X position, from 0 (left) to 1 (right).
+        float x = 0;
+        /// The normalized Y position, from 0 (top) to 1 (bottom).
+        float y = 0;
+        /// The normalized pressure.
+        float pressure = 0;
+    };
+
+    /// The SDL joystick instance id of the gamepad.
+    SDL_JoystickID device = 0;
+    /// The slot of the gamepad.
+    DeviceSlot slot;
+    /// The index of the touchpad.
+    int touchpad = 0;
+    /// The index of the finger.
+    int finger = 0;
+    /// Set when the finger touched the touchpad during the cycle, the first point is the touch.
+    bool began = false;
+    /// Set when the finger was lifted or the gamepad was disconnected during the cycle, the last point is the lift.
+    bool ended = false;
+    /// The estimated velocity along X at the last point, in touchpad widths per second.
+    float velocityX = 0;
+    /// The estimated velocity along Y at the last point, in touchpad heights per second.
+    float velocityY = 0;
+    /// The points of the cycle, from the oldest to the newest.
+    QVarLengthArray<Point, 16> points;
+};
+
+/**
+ * @brief The GamepadTouchpadTracker class folds gamepad touchpad events into per-finger trajectories.
+ *
+ * The tracker keeps the state of each finger of each gamepad. The samples of a polling cycle are
+ * gathered into one compact polyline per finger: the points are at least `MIN_DISTANCE` apart, and the last
+ * point is always the latest sample. The touch and the lift are always kept. The velocity is smoothed over
+ * all samples with a time constant of `VELOCITY_TIME_CONSTANT` seconds.
+ *
+ * The tracker is not thread-safe. It is owned and used by the `SDLEventManager` thread.
+ * @see SDLEventManager::setTouchpadTracking
+ */
+class QTSDL_EXPORT GamepadTouchpadTracker
+{
+public:
+    /// The smallest normalized distance between two points of a polyline.
+    static constexpr float MIN_DISTANCE = 0.002f;
+    /// The time constant of the velocity smoothing in seconds.
+    static constexpr float VELOCITY_TIME_CONSTANT = 0.03f;
+
+    GamepadTouchpadTracker() = default;
+
+    /**
+     * @brief Applies a gamepad touchpad event.
+     * @param event The SDL event.
+     * @return true if the event was a touchpad event and was folded into a trajectory.
+     */
+    bool process(const SDL_Event& event);
+
+    /**
+     * @brief Ends the trajectories of the fingers of a disconnected gamepad.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param timestamp The SDL timestamp of the disconnection.
+     */
+    void removeDevice(SDL_JoystickID device, Uint64 timestamp);
+
+    /**
+     * @brief Forgets all fingers.
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether trajectories are waiting for `takeTrajectories()`.
+     */
+    bool hasPending() const;
+
+    /**
+     * @brief Returns the trajectories of the fingers that changed since the previous call.
+     *
+     * The trajectories of fingers that are still down continue from their last point in the next cycle.
+     * @return The trajectories that ended in the order they ended, then the trajectories of the fingers that are still down.
+     */
+    QList<TouchpadTrajectory> takeTrajectories();
+
+private:
+    /**
+     * @brief The Finger struct keeps the state of one finger between cycles.
+     */
+    struct Finger {
+        /// The trajectory of the current cycle.
+        TouchpadTrajectory trajectory;
+        /// The last sample, used by the velocity estimate.
+        TouchpadTrajectory::Point last;
+        /// The last point kept because of its distance.
+        TouchpadTrajectory::Point anchor;
+        /// Set when the last point of the trajectory is closer than `MIN_DISTANCE` to the anchor and may be replaced.
+        bool tailPending = false;
+        /// Set when the trajectory has points of the current cycle.
+        bool dirty = false;
+    };
+
+    static quint64 key(SDL_JoystickID device, int touchpad, int finger);
+
+    /**
+     * @brief Appends a sample to the trajectory of a finger and updates its velocity.
+     * @param key The key of the finger.
+     * @param finger The finger.
+     * @param point The sample.
+     * @param force true to keep the sample as a point even when it is too close to the previous point.
+     */
+    void addPoint(quint64 key, Finger& finger, const TouchpadTrajectory::Point& point, bool force);
+
+    /**
+     * @brief Moves the trajectory of a lifted finger to the completed trajectories.
+     * @param key The key of the finger.
+     * @param finger The finger.
+     */
+    void finish(quint64 key, Finger& finger);
+
+    QHash<quint64, Finger> _fingers;
+    /// The keys of the fingers with points in the current cycle, in the order of their first point.
+    QList<quint64> _dirty;
+    /// The trajectories completed in the current cycle.
+    QList<TouchpadTrajectory> _completed;
+};
+} // namespace QtSDL
+#endif // GAMEPADTOUCHPADTRACKER_H
@@ -0,0 +1,210 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "inputrecorder.h"
+#include <QDebug>
+#include <QMutexLocker>
+#include <QThread>
+#include <QtEndian>
+#include <cstring>
+
+namespace QtSDL {
+
+namespace {
+
+/**
+ * @brief The initial capacity of the staging buffer in bytes.
+ */
+constexpr qsizetype STAGING_RESERVE = 16 * 1024;
+
+template<class T>
+void appendLittleEndian(QByteArray& buffer, T value) {
+    const T encoded = qToLittleEndian(value);
+    buffer.append(reinterpret_cast<const char*>(&encoded), sizeof(encoded));
+}
+}
+
+InputRecorder::InputRecorder() {
+
+}
+
+InputRecorder::~InputRecorder() {
+    close();
+}
+
+bool InputRecorder::open(const QString &path, Options options) {
+    close();
+
+    _file.setFileName(path);
+    if (!_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "InputRecorder: failed to create" << path << ":" << _file.errorString();
+        return false;
+    }
+
+    _options = options;
+    _lastTimestamp = SDL_GetTicksNS();
+    _recordedEvents = 0;
+    _writtenBytes = 0;
+    _closing = false;
+    _pending.clear();
+
+    _staging.resize(0);
+    _staging.reserve(STAGING_RESERVE);
+    _staging.append(MAGIC, sizeof(MAGIC));
+    appendLittleEndian<quint16>(_staging, FORMAT_VERSION);
+    appendLittleEndian<quint16>(_staging, static_cast<quint16>(options.toInt()));
+    appendLittleEndian<quint32>(_staging, 0);
+    appendLittleEndian<quint64>(_staging, _lastTimestamp);
+    commit();
+
+    _writer = QThread::create([this]() {
+        writeLoop();
+    });
+    _writer->start();
+
+    return true;
+}
+
+void InputRecorder::close() {
+    if (!_writer) {
+        return;
+    }
+
+    commit();
+    {
+        QMutexLocker locker(&_mutex);
+        _closing = true;
+        _condition.wakeOne();
+    }
+
+    _writer->wait();
+    delete _writer;
+    _writer = nullptr;
+
+    _file.close();
+}
+
+bool InputRecorder::isOpen() const {
+    return _writer;
+}
+
+quint64 InputRecorder::recordedEvents() const {
+    return _recordedEvents.load(std::memory_order_relaxed);
+}
+
+quint64 InputRecorder::writtenBytes() const {
+    return _writtenBytes.load(std::memory_order_relaxed);
+}
+
+void InputRecorder::writeTimestamp(Uint64 timestamp) {
+    if (!(_options & DeltaTimestamps)) {
+        appendLittleEndian<quint64>(_staging, timestamp);
+        return;
+    }
+
+    // Timestamps of different SDL subsystems may be slightly out of order, such records get a zero delta.
+    quint64 delta = (timestamp > _lastTimestamp)? timestamp - _lastTimestamp: 0;
+    _lastTimestamp = std::max(timestamp, _lastTimestamp);
+
+    do {
+        quint8 byte = delta & 0x7F;
+        delta >>= 7;
+        if (delta) {
+            byte |= 0x80;
+        }
+        _staging.append(static_cast<char>(byte));
+    } while (delta);
+}
+
+bool InputRecorder::writeEvent(const SDL_Event &event) {
+    if (!isRecordable(event.type)) {
+        return false;
+    }
+
+    const auto bytes = reinterpret_cast<const char*>(&event);
+
+    qsizetype payload = sizeof(SDL_Event);
+    while (payload > EVENT_HEADER_SIZE && !bytes[payload - 1]) {
+        --payload;
+    }
+    payload -= EVENT_HEADER_SIZE;
+
+    _staging.append(static_cast<char>(RecordKind::Event));
+    writeTimestamp(event.common.timestamp);
+    appendLittleEndian<quint32>(_staging, event.type);
+    _staging.append(static_cast<char>(payload));
+    _staging.append(bytes + EVENT_HEADER_SIZE, payload);
+
+    _recordedEvents.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool InputRecorder::isRecordable(Uint32 type) {
+    return (type >= SDL_EVENT_JOYSTICK_AXIS_MOTION && type <= SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED) ||
+           type == SDL_EVENT_SENSOR_UPDATE;
+}
+
+void InputRecorder::writeDevice(SDL_JoystickID device, Uint64 timestamp) {
+    const SDL_GUID guid = SDL_GetGamepadGUIDForID(device);
+    const char* name = SDL_GetGamepadNameForID(device);
+    const qsizetype nameSize = (name)? std::min<qsizetype>(std::strlen(name), 0xFF): 0;
+
+    _staging.append(static_cast<char>(RecordKind::Device));
+    writeTimestamp(timestamp);
+    appendLittleEndian<quint32>(_staging, device);
+    _staging.append(reinterpret_cast<const char*>(guid.data), sizeof(guid.data));
+    appendLittleEndian<quint16>(_staging, SDL_GetGamepadVendorForID(device));
+    appendLittleEndian<quint16>(_staging, SDL_GetGamepadProductForID(device));
+    _staging.append(static_cast<char>(nameSize));
+    _staging.append(name, nameSize);
+}
+
+void InputRecorder::commit() {
+    if (_staging.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker locker(&_mutex);
+    if (_pending.isEmpty()) {
+        _pending.swap(_staging);
+    } else {
+        _pending.append(_staging);
+    }
+    _staging.resize(0);
+    _condition.wakeOne();
+}
+
+void InputRecorder::writeLoop() {
+    QByteArray block;
+
+    while (true) {
+        {
+            QMutexLocker locker(&_mutex);
+            while (_pending.isEmpty() && !_closing) {
+                _condition.wait(&_mutex);
+            }
+
+            if (_pending.isEmpty() && _closing) {
+                break;
+            }
+
+            // Swapping keeps the allocations of both buffers, so the steady state does not allocate.
+            block.swap(_pending);
+        }
+
+        const qint64 written = _file.write(block);
+        if (written != block.size()) {
+            qWarning() << "InputRecorder: failed to write the recording:" << _file.errorString();
+        }
+
+        _writtenBytes.fetch_add(std::max<qint64>(written, 0), std::memory_order_relaxed);
+        block.resize(0);
+    }
+
+    _file.flush();
+}
+}
@@ -0,0 +1,195 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QFlags>
+#include <QMutex>
+#include <QWaitCondition>
+#include <SDL3/SDL.h>
+#include <atomic>
+#include "global.h"
+
+class QThread;
+
+namespace QtSDL {
+
+/**
+ * @brief The InputRecorder class writes the SDL events seen by `SDLEventManager` into a binary recording.
+ *
+ * The recording starts with a 24-byte header:
+ *
+ * | Size | Field                                            |
+ * |------|--------------------------------------------------|
+ * | 8    | `MAGIC`                                          |
+ * | 2    | format version, `FORMAT_VERSION`                 |
+ * | 2    | `Options` of the recording                       |
+ * | 4    | reserved, 0                                      |
+ * | 8    | SDL time (in nanoseconds) of the recording start |
+ *
+ * It is followed by records. Each record starts with a `RecordKind` byte and a timestamp, stored as
+ * an unsigned LEB128 difference to the previous record with `DeltaTimestamps`, or as 8 bytes otherwise.
+ *
+ * - `RecordKind::Event`: the 4-byte event type, a 1-byte payload size and the payload. The payload is
+ *   the `SDL_Event` structure after its common header (type, reserved and timestamp) with trailing
+ *   zero bytes removed. Only the types accepted by `isRecordable()` are written.
+ * - `RecordKind::Device`: the 4-byte joystick instance id, the 16-byte GUID, 2-byte vendor and
+ *   product ids, a 1-byte name size and the UTF-8 name of a gamepad.
+ *
+ * All numbers are little-endian.
+ *
+ * Records are encoded on the `SDLEventManager` thread into a staging buffer, and the buffer is written
+ * to the file by a background writer thread, so the polling loop never waits for the disk.
+ * @see SDLEventManager::setRecorder, InputReplay
+ */
+class QTSDL_EXPORT InputRecorder
+{
+public:
+    /**
+     * @brief The Option enum defines the encoding options of a recording.
+     */
+    enum Option: quint16 {
+        /// Timestamps are stored as full 8-byte values.
+        NoOptions = 0x0,
+        /// Timestamps are stored as variable-length differences to the previous record.
+        DeltaTimestamps = 0x1
+    };
+    Q_DECLARE_FLAGS(Options, Option)
+
+    /**
+     * @brief The RecordKind enum defines the types of records.
+     */
+    enum class RecordKind: quint8 {
+        /// The end of the recording. It is never written to the file.
+        End = 0,
+        /// An SDL event.
+        Event = 1,
+        /// The description of a connected gamepad.
+        Device = 2
+    };
+
+    /**
+     * @brief The signature at the start of each recording.
+     */
+    static constexpr char MAGIC[8] = {'Q', 'S', 'D', 'L', 'R', 'E', 'C', '\0'};
+
+    /**
+     * @brief The version of the recording format written by this class.
+     */
+    static constexpr quint16 FORMAT_VERSION = 1;
+
+    /**
+     * @brief The size of the recording header in bytes.
+     */
+    static constexpr qsizetype HEADER_SIZE = 24;
+
+    /**
+     * @brief The size of the common header of `SDL_Event` (type, reserved and timestamp), which is not stored in the payload.
+     */
+    static constexpr qsizetype EVENT_HEADER_SIZE = 16;
+
+    InputRecorder();
+
+    /**
+     * @brief Closes the recording, writing all pending records.
+     */
+    ~InputRecorder();
+
+    /**
+     * @brief Creates a new recording file and starts the writer thread.
+     * @param path The path of the file. An existing file is overwritten.
+     * @param options The encoding options.
+     * @return true if the file was created.
+     */
+    bool open(const QString& path, Options options = DeltaTimestamps);
+
+    /**
+     * @brief Writes all pending records, stops the writer thread and closes the file.
+     *
+     * Detach the recorder from the manager with `SDLEventManager::setRecorder(nullptr)` before closing it.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether the recording file is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Returns the number of event records encoded since the recording was opened.
+     */
+    quint64 recordedEvents() const;
+
+    /**
+     * @brief Returns the number of bytes written to the file, including the header.
+     */
+    quint64 writtenBytes() const;
+
+    /**
+     * @brief Encodes an SDL event into the staging buffer.
+     *
+     * Must be called from the `SDLEventManager` thread. Events rejected by `isRecordable()` are not written.
+     * @param event The SDL event.
+     * @return true if the event was written.
+     */
+    bool writeEvent(const SDL_Event& event);
+
+    /**
+     * @brief Checks whether events of the type can be recorded.
+     *
+     * Only joystick, gamepad and sensor events are recorded. Their structures do not contain pointers,
+     * so they stay valid when they are read back. Events such as text input, drop, clipboard and
+     * user events point to memory that does not exist anymore at the replay time.
+     * @param type The SDL event type.
+     * @return true if the events of the type are recorded.
+     */
+    static bool isRecordable(Uint32 type);
+
+    /**
+     * @brief Encodes the description of a gamepad into the staging buffer.
+     *
+     * Must be called from the `SDLEventManager` thread. The GUID, ids and name are read from SDL.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param timestamp The SDL time of the record in nanoseconds.
+     */
+    void writeDevice(SDL_JoystickID device, Uint64 timestamp);
+
+    /**
+     * @brief Hands the staging buffer over to the writer thread.
+     *
+     * Must be called from the `SDLEventManager` thread, usually once per polling cycle. It never waits for the disk.
+     */
+    void commit();
+
+private:
+    void writeTimestamp(Uint64 timestamp);
+    void writeLoop();
+
+    QFile _file;
+    QThread* _writer = nullptr;
+    Options _options = DeltaTimestamps;
+
+    QByteArray _staging;
+    Uint64 _lastTimestamp = 0;
+
+    QMutex _mutex;
+    QWaitCondition _condition;
+    QByteArray _pending;
+    bool _closing = false;
+
+    std::atomic<quint64> _recordedEvents {0};
+    std::atomic<quint64> _writtenBytes {0};
+};
+} // namespace QtSDL
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QtSDL::InputRecorder::Options)
+
+#endif // INPUTRECORDER_H
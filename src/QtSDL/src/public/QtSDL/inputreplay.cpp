@@ -0,0 +1,212 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "inputreplay.h"
+#include <QDebug>
+#include <QtEndian>
+#include <cstring>
+
+namespace QtSDL {
+
+DeviceInfo InputReplay::RecordedDevice::toDeviceInfo() const {
+    DeviceInfo info;
+    info.id = id;
+    info.name = QString::fromUtf8(name);
+    info.vendor = vendor;
+    info.product = product;
+    info.guid = guid;
+    return info;
+}
+
+InputReplay::~InputReplay() {
+    close();
+}
+
+bool InputReplay::open(const QString &path) {
+    close();
+
+    _file.setFileName(path);
+    if (!_file.open(QIODevice::ReadOnly)) {
+        qWarning() << "InputReplay: failed to open" << path << ":" << _file.errorString();
+        return false;
+    }
+
+    const qint64 size = _file.size();
+    if (size < InputRecorder::HEADER_SIZE) {
+        qWarning() << "InputReplay:" << path << "is not a recording";
+        close();
+        return false;
+    }
+
+    _data = _file.map(0, size);
+    if (!_data) {
+        qWarning() << "InputReplay: failed to map" << path << ":" << _file.errorString();
+        close();
+        return false;
+    }
+    _size = size;
+
+    const quint16 version = qFromLittleEndian<quint16>(_data + 8);
+    if (std::memcmp(_data, InputRecorder::MAGIC, sizeof(InputRecorder::MAGIC)) ||
+        version > InputRecorder::FORMAT_VERSION) {
+        qWarning() << "InputReplay:" << path << "is not a supported recording";
+        close();
+        return false;
+    }
+
+    _options = InputRecorder::Options::fromInt(qFromLittleEndian<quint16>(_data + 10));
+    _startTimestamp = qFromLittleEndian<quint64>(_data + 16);
+    rewind();
+
+    return true;
+}
+
+void InputReplay::close() {
+    if (_data) {
+        _file.unmap(const_cast<uchar*>(_data));
+    }
+
+    _data = nullptr;
+    _size = 0;
+    _position = 0;
+    _file.close();
+}
+
+bool InputReplay::isOpen() const {
+    return _data;
+}
+
+InputRecorder::Options InputReplay::options() const {
+    return _options;
+}
+
+Uint64 InputReplay::startTimestamp() const {
+    return _startTimestamp;
+}
+
+void InputReplay::rewind() {
+    _position = InputRecorder::HEADER_SIZE;
+    _lastTimestamp = _startTimestamp;
+    _corrupted = false;
+}
+
+bool InputReplay::isCorrupted() const {
+    return _corrupted;
+}
+
+bool InputReplay::canRead(qint64 size) const {
+    return _size - _position >= size;
+}
+
+bool InputReplay::readTimestamp(Uint64 &timestamp) {
+    if (!(_options & InputRecorder::DeltaTimestamps)) {
+        if (!canRead(sizeof(quint64))) {
+            return false;
+        }
+
+        timestamp = qFromLittleEndian<quint64>(_data + _position);
+        _position += sizeof(quint64);
+        return true;
+    }
+
+    quint64 delta = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (!canRead(1)) {
+            return false;
+        }
+
+        const quint8 byte = _data[_position++];
+        delta |= static_cast<quint64>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            _lastTimestamp += delta;
+            timestamp = _lastTimestamp;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+InputRecorder::RecordKind InputReplay::next(SDL_Event &event, RecordedDevice &device) {
+    using RecordKind = InputRecorder::RecordKind;
+
+    RecordKind kind;
+    do {
+        kind = readRecord(event, device);
+    } while (kind == RecordKind::Event && !InputRecorder::isRecordable(event.type));
+
+    return kind;
+}
+
+InputRecorder::RecordKind InputReplay::readRecord(SDL_Event &event, RecordedDevice &device) {
+    using RecordKind = InputRecorder::RecordKind;
+
+    if (!_data || _corrupted || !canRead(1)) {
+        return RecordKind::End;
+    }
+
+    const auto kind = static_cast<RecordKind>(_data[_position++]);
+    Uint64 timestamp = 0;
+    if (!readTimestamp(timestamp)) {
+        _corrupted = true;
+        return RecordKind::End;
+    }
+
+    switch (kind) {
+    case RecordKind::Event: {
+        if (!canRead(sizeof(quint32) + 1)) {
+            break;
+        }
+
+        const quint32 type = qFromLittleEndian<quint32>(_data + _position);
+        const qint64 payload = _data[_position + sizeof(quint32)];
+        _position += sizeof(quint32) + 1;
+
+        if (payload > qint64(sizeof(SDL_Event)) - InputRecorder::EVENT_HEADER_SIZE || !canRead(payload)) {
+            break;
+        }
+
+        SDL_zero(event);
+        std::memcpy(reinterpret_cast<uchar*>(&event) + InputRecorder::EVENT_HEADER_SIZE, _data + _position, payload);
+        _position += payload;
+
+        event.type = type;
+        event.common.timestamp = timestamp;
+        return RecordKind::Event;
+    }
+
+    case RecordKind::Device: {
+        constexpr qint64 fixedSize = sizeof(quint32) + sizeof(SDL_GUID::data) + 2 * sizeof(quint16) + 1;
+        if (!canRead(fixedSize)) {
+            break;
+        }
+
+        device.id = qFromLittleEndian<quint32>(_data + _position);
+        std::memcpy(device.guid.data, _data + _position + 4, sizeof(device.guid.data));
+        device.vendor = qFromLittleEndian<quint16>(_data + _position + 20);
+        device.product = qFromLittleEndian<quint16>(_data + _position + 22);
+        const qint64 nameSize = _data[_position + 24];
+        _position += fixedSize;
+
+        if (!canRead(nameSize)) {
+            break;
+        }
+
+        device.name = QByteArray(reinterpret_cast<const char*>(_data + _position), nameSize);
+        _position += nameSize;
+        return RecordKind::Device;
+    }
+
+    case RecordKind::End:
+    default:
+        break;
+    }
+
+    _corrupted = true;
+    return RecordKind::End;
+}
+}
@@ -0,0 +1,123 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef INPUTREPLAY_H
+#define INPUTREPLAY_H
+
+#include <QByteArray>
+#include <QFile>
+#include <SDL3/SDL.h>
+#include "deviceinfo.h"
+#include "global.h"
+#include "inputrecorder.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The InputReplay class reads a recording written by `InputRecorder`.
+ *
+ * The file is memory-mapped and decoded record by record without copying it into memory.
+ * Pass an opened replay to `SDLEventManager::startReplay()` to feed the recorded events through
+ * the same processing and delivery path as live input, or iterate the records with `next()`.
+ */
+class QTSDL_EXPORT InputReplay
+{
+public:
+    /**
+     * @brief The RecordedDevice struct describes a gamepad stored in the recording.
+     */
+    struct RecordedDevice {
+        /// The SDL joystick instance id of the gamepad at the time of the recording.
+        SDL_JoystickID id = 0;
+        /// The GUID of the gamepad.
+        SDL_GUID guid {};
+        /// The USB vendor id of the gamepad.
+        Uint16 vendor = 0;
+        /// The USB product id of the gamepad.
+        Uint16 product = 0;
+        /// The UTF-8 name of the gamepad.
+        QByteArray name;
+
+        /**
+         * @brief Returns the description of the recorded gamepad.
+         *
+         * The recording keeps the identity of the gamepad only, so its capabilities are empty.
+         */
+        DeviceInfo toDeviceInfo() const;
+    };
+
+    InputReplay() = default;
+    ~InputReplay();
+
+    InputReplay(const InputReplay&) = delete;
+    InputReplay& operator=(const InputReplay&) = delete;
+
+    /**
+     * @brief Maps a recording into memory and validates its header.
+     * @param path The path of the recording.
+     * @return true if the recording can be replayed.
+     */
+    bool open(const QString& path);
+
+    /**
+     * @brief Unmaps and closes the recording.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a recording is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Returns the encoding options of the recording.
+     */
+    InputRecorder::Options options() const;
+
+    /**
+     * @brief Returns the SDL time (in nanoseconds) at which the recording was started.
+     */
+    Uint64 startTimestamp() const;
+
+    /**
+     * @brief Decodes the next record.
+     *
+     * Event records of types rejected by `InputRecorder::isRecordable()` are skipped.
+     * @param event Receives the event of a `RecordKind::Event` record.
+     * @param device Receives the description of a `RecordKind::Device` record.
+     * @return The kind of the decoded record, or `RecordKind::End` at the end of the recording
+     * or if the rest of the file is corrupted.
+     */
+    InputRecorder::RecordKind next(SDL_Event& event, RecordedDevice& device);
+
+    /**
+     * @brief Returns to the first record.
+     */
+    void rewind();
+
+    /**
+     * @brief Checks whether the replay stopped on a damaged record.
+     */
+    bool isCorrupted() const;
+
+private:
+    InputRecorder::RecordKind readRecord(SDL_Event& event, RecordedDevice& device);
+    bool readTimestamp(Uint64& timestamp);
+    bool canRead(qint64 size) const;
+
+    QFile _file;
+    const uchar* _data = nullptr;
+    qint64 _size = 0;
+    qint64 _position = 0;
+    Uint64 _lastTimestamp = 0;
+    Uint64 _startTimestamp = 0;
+    InputRecorder::Options _options;
+    bool _corrupted = false;
+};
+} // namespace QtSDL
+#endif // INPUTREPLAY_H
@@ -0,0 +1,46 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdlactionevent.h"
+#include "qsdlevent.h"
+
+namespace QtSDL {
+
+QSDLActionEvent::QSDLActionEvent(const GamepadActionMapper::Transition &transition, DeviceSlot slot):
+    QEvent(static_cast<QEvent::Type>(QSDLEvent::SDLActionType)),
+    _transition(transition),
+    _slot(slot) {
+}
+
+QEvent *QSDLActionEvent::clone() const {
+    return new QSDLActionEvent(_transition, _slot);
+}
+
+const GamepadActionMapper::Transition &QSDLActionEvent::transition() const {
+    return _transition;
+}
+
+int QSDLActionEvent::action() const {
+    return _transition.action;
+}
+
+const QString &QSDLActionEvent::name() const {
+    return _transition.name;
+}
+
+bool QSDLActionEvent::isActive() const {
+    return _transition.active;
+}
+
+SDL_JoystickID QSDLActionEvent::device() const {
+    return _transition.device;
+}
+
+DeviceSlot QSDLActionEvent::deviceSlot() const {
+    return _slot;
+}
+}
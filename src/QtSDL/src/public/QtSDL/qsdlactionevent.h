@@ -0,0 +1,78 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLACTIONEVENT_H
+#define QSDLACTIONEVENT_H
+
+#include <QEvent>
+#include <SDL3/SDL.h>
+#include "deviceslot.h"
+#include "gamepadactionmapper.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLActionEvent class delivers a change of the state of a mapped action.
+ *
+ * When `SDLEventManager::setActionMappingEnabled()` is enabled, the manager evaluates the action map
+ * against the button and axis events of each gamepad and posts this event only when an action
+ * becomes active or is released.
+ */
+class QTSDL_EXPORT QSDLActionEvent: public QEvent
+{
+public:
+    /**
+     * @brief Constructs an action event.
+     * @param transition The change of the action.
+     * @param slot The slot of the gamepad.
+     */
+    explicit QSDLActionEvent(const GamepadActionMapper::Transition& transition, DeviceSlot slot = {});
+
+    /**
+     * @brief Creates a deep copy of the event.
+     * @return A pointer to a newly allocated `QSDLActionEvent` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns the change of the action.
+     */
+    const GamepadActionMapper::Transition& transition() const;
+
+    /**
+     * @brief Returns the id of the action.
+     */
+    int action() const;
+
+    /**
+     * @brief Returns the name of the action.
+     */
+    const QString& name() const;
+
+    /**
+     * @brief Returns true if the action became active, false if it was released.
+     */
+    bool isActive() const;
+
+    /**
+     * @brief Returns the SDL joystick instance id of the gamepad.
+     */
+    SDL_JoystickID device() const;
+
+    /**
+     * @brief Returns the slot of the gamepad.
+     */
+    DeviceSlot deviceSlot() const;
+
+private:
+    GamepadActionMapper::Transition _transition;
+    DeviceSlot _slot;
+};
+} // namespace QtSDL
+#endif // QSDLACTIONEVENT_H
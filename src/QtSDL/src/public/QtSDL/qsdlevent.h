@@ -10,11 +10,16 @@
 #define QSDLEVENT_H
 
 #include <QEvent>      // Base class for Qt events
+#include <QString>
 #include <SDL3/SDL.h> // Include SDL3 header for SDL_Event and SDL_EventType
+#include <memory>
+#include "deviceslot.h"
 #include "global.h"
 
 namespace QtSDL {
 
+class SDLEventMetrics;
+
 /**
  * @brief The QSDLEvent class provides a custom Qt event for encapsulating SDL events.
  *
@@ -43,7 +48,13 @@ public:
      * custom, application-specific event.
      */
     enum Type {
-        SDLType = QEvent::Type::User ///< The custom QEvent type for all QSDLEvent instances.
+        SDLType = QEvent::Type::User, ///< The custom QEvent type for all QSDLEvent instances.
+        SDLBatchType,                 ///< The custom QEvent type of `QSDLEventBatch` instances.
+        SDLSensorBlockType,           ///< The custom QEvent type of `QSDLGamepadSensorBlockEvent` instances.
+        SDLJoystickStateType,         ///< The custom QEvent type of `QSDLJoystickStateEvent` instances.
+        SDLActionType,                ///< The custom QEvent type of `QSDLActionEvent` instances.
+        SDLTouchpadTrajectoryType,    ///< The custom QEvent type of `QSDLGamepadTouchpadTrajectoryEvent` instances.
+        SDLOrientationType            ///< The custom QEvent type of `QSDLGamepadOrientationEvent` instances.
     };
 
     /**
@@ -61,6 +72,29 @@ public:
      */
     explicit QSDLEvent(SDL_Event event, SDL_EventType type);
 
+    /**
+     * @brief Destroys the event. Qt destroys posted events right after delivering them, so the
+     * post-to-delivery latency is recorded here when the event carries metrics.
+     */
+    ~QSDLEvent() override;
+
+    /**
+     * @brief Allocates memory for QSDLEvent and its subclasses from the `QSDLEventPool`.
+     *
+     * Events are created on the `SDLEventManager` thread for each SDL event, so the pool
+     * removes the global allocator from the hottest path of the library.
+     * @param size The size of the allocated object.
+     * @return A pointer to the allocated memory.
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * @brief Returns the memory of a destroyed event to the `QSDLEventPool`.
+     * @param ptr The pointer to the memory of the destroyed event.
+     * @param size The size of the destroyed object.
+     */
+    static void operator delete(void* ptr, std::size_t size);
+
 
     /**
      * @brief Sets the accepted status of the event.
@@ -116,10 +150,12 @@ public:
      *
      * This utility method is useful for debugging, logging, or displaying
      * the type of the underlying SDL event in a user-friendly format.
-     * @return A `QString` containing the human-readable name of the `SDL_EventType`.
-     * Returns an empty string or "Unknown SDL Event Type" if the type is unrecognized.
+     * The name is taken from a static table, so this method never allocates.
+     * @return The name of the `SDL_EventType` enumerator, for example `SDL_EVENT_GAMEPAD_ADDED`.
+     * Returns `SDL_EVENT_USER` for all user events and `SDL_EVENT_UNKNOWN` if the type is unrecognized.
+     * @see SDLEventTypes
      */
-    QString sdlEventTypeName() const;
+    QLatin1StringView sdlEventTypeName() const;
 
     /**
      * @brief Sets the specific `SDL_EventType` for the encapsulated event.
@@ -129,6 +165,38 @@ public:
      */
     void setSdlType(SDL_EventType newSdlType);
 
+    /**
+     * @brief Returns the SDL timestamp of the encapsulated event.
+     * @return The time (in nanoseconds of `SDL_GetTicksNS()`) at which SDL queued the event.
+     */
+    Uint64 sdlTimestamp() const;
+
+    /**
+     * @brief Returns the time at which `SDLEventManager` posted the event.
+     * @return The time in nanoseconds of `SDL_GetTicksNS()`, or 0 if the event was not posted by the manager.
+     */
+    Uint64 postedTimestamp() const;
+
+    /**
+     * @brief Marks the event as posted.
+     * @param timestamp The post time in nanoseconds of `SDL_GetTicksNS()`.
+     * @param metrics The metrics that receive the post-to-delivery latency of the event, or nullptr.
+     */
+    void markPosted(Uint64 timestamp, const std::shared_ptr<SDLEventMetrics>& metrics = {});
+
+    /**
+     * @brief Returns the slot of the device that produced the event.
+     * @return The slot, or a null slot if the event does not belong to a gamepad opened by `SDLEventManager`.
+     * @see SDLEventManager::deviceInfo
+     */
+    DeviceSlot deviceSlot() const;
+
+    /**
+     * @brief Sets the slot of the device that produced the event.
+     * @param newDeviceSlot The slot of the device.
+     */
+    void setDeviceSlot(DeviceSlot newDeviceSlot);
+
 private:
     /**
      * @brief The raw `SDL_Event` structure containing event-specific data.
@@ -147,6 +215,21 @@ private:
      * and inspect its `type` member. It serves as a convenient cached value.
      */
     SDL_EventType _sdlType;
+
+    /**
+     * @brief The time at which the event was posted by `SDLEventManager`.
+     */
+    Uint64 _postedTimestamp = 0;
+
+    /**
+     * @brief The metrics that receive the post-to-delivery latency, set only while metrics are enabled.
+     */
+    std::shared_ptr<SDLEventMetrics> _metrics;
+
+    /**
+     * @brief The slot of the device that produced the event.
+     */
+    DeviceSlot _deviceSlot;
 };
 } // namespace QtSDL
 #endif // QSDLEVENT_H
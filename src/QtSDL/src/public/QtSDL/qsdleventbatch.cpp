@@ -0,0 +1,121 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdleventbatch.h"
+#include "qsdlevent.h"
+#include "sdleventmetrics.h"
+
+namespace QtSDL {
+
+QSDLEventBatch::QSDLEventBatch(QList<SDL_Event> events):
+    QEvent(static_cast<QEvent::Type>(QSDLEvent::SDLBatchType)),
+    _events(std::move(events)) {
+}
+
+QSDLEventBatch::~QSDLEventBatch() {
+    if (_metrics) {
+        _metrics->recordDelivered(SDL_GetTicksNS() - _postedTimestamp, static_cast<quint64>(_events.size()));
+    }
+}
+
+QEvent *QSDLEventBatch::clone() const {
+    auto batch = new QSDLEventBatch(_events);
+    batch->setDeviceSlots(_deviceSlots);
+    batch->setAxisSamples(_axisSamples);
+    return batch;
+}
+
+const QList<SDL_Event> &QSDLEventBatch::events() const {
+    return _events;
+}
+
+qsizetype QSDLEventBatch::size() const {
+    return _events.size();
+}
+
+bool QSDLEventBatch::isEmpty() const {
+    return _events.isEmpty();
+}
+
+const SDL_Event &QSDLEventBatch::at(qsizetype index) const {
+    return _events.at(index);
+}
+
+QList<SDL_Event>::const_iterator QSDLEventBatch::begin() const {
+    return _events.cbegin();
+}
+
+QList<SDL_Event>::const_iterator QSDLEventBatch::end() const {
+    return _events.cend();
+}
+
+qsizetype QSDLEventBatch::count(SDL_EventType type) const {
+    qsizetype result = 0;
+    for (const SDL_Event& event : _events) {
+        result += (event.type == type);
+    }
+
+    return result;
+}
+
+bool QSDLEventBatch::isDeviceEvent(const SDL_Event &event) {
+    // all joystick and gamepad events share the same header with the `which` field.
+    return event.type >= SDL_EVENT_JOYSTICK_AXIS_MOTION &&
+           event.type <= SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED;
+}
+
+Uint64 QSDLEventBatch::postedTimestamp() const {
+    return _postedTimestamp;
+}
+
+void QSDLEventBatch::markPosted(Uint64 timestamp, const std::shared_ptr<SDLEventMetrics> &metrics) {
+    _postedTimestamp = timestamp;
+    _metrics = metrics;
+}
+
+DeviceSlot QSDLEventBatch::deviceSlot(const SDL_Event &event) const {
+    return (isDeviceEvent(event))? findDeviceSlot(_deviceSlots, event.jdevice.which): DeviceSlot {};
+}
+
+const DeviceSlotTable &QSDLEventBatch::deviceSlots() const {
+    return _deviceSlots;
+}
+
+void QSDLEventBatch::setDeviceSlots(const DeviceSlotTable &newDeviceSlots) {
+    _deviceSlots = newDeviceSlots;
+}
+
+quint32 QSDLEventBatch::samples(const SDL_Event &event) const {
+    if (event.type != SDL_EVENT_GAMEPAD_AXIS_MOTION || _axisSamples.isEmpty()) {
+        return 1;
+    }
+
+    auto it = _axisSamples.constFind(axisKey(event.gaxis));
+    return (it != _axisSamples.constEnd())? it->samples: 1;
+}
+
+Uint64 QSDLEventBatch::firstTimestamp(const SDL_Event &event) const {
+    if (event.type != SDL_EVENT_GAMEPAD_AXIS_MOTION || _axisSamples.isEmpty()) {
+        return event.common.timestamp;
+    }
+
+    auto it = _axisSamples.constFind(axisKey(event.gaxis));
+    return (it != _axisSamples.constEnd())? it->firstTimestamp: event.gaxis.timestamp;
+}
+
+const QHash<quint64, QSDLEventBatch::AxisSamples> &QSDLEventBatch::axisSamples() const {
+    return _axisSamples;
+}
+
+void QSDLEventBatch::setAxisSamples(const QHash<quint64, AxisSamples> &newAxisSamples) {
+    _axisSamples = newAxisSamples;
+}
+
+quint64 QSDLEventBatch::axisKey(const SDL_GamepadAxisEvent &event) {
+    return (static_cast<quint64>(event.which) << 8) | event.axis;
+}
+}
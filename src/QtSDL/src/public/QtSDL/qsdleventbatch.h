@@ -0,0 +1,241 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLEVENTBATCH_H
+#define QSDLEVENTBATCH_H
+
+#include <QEvent>
+#include <QHash>
+#include <QList>
+#include <SDL3/SDL.h>
+#include <memory>
+#include "deviceslot.h"
+#include "global.h"
+
+namespace QtSDL {
+
+class SDLEventMetrics;
+
+/**
+ * @brief The QSDLEventBatch class carries all SDL events drained by `SDLEventManager` in one polling cycle.
+ *
+ * In the `SDLEventManager::DeliveryMode::Batched` mode the manager posts a single
+ * QSDLEventBatch per cycle instead of one `QSDLEvent` per SDL event. The events are stored
+ * in a contiguous array in the same order as they were received from SDL.
+ *
+ * Use the `forEachOfType()` and `forEachOfDevice()` helpers to walk only the events you are interested in:
+ *
+ * @code
+ * if (event->type() == static_cast<QEvent::Type>(QSDLEvent::SDLBatchType)) {
+ *     auto batch = static_cast<QSDLEventBatch*>(event);
+ *     batch->forEachOfType(SDL_EVENT_GAMEPAD_BUTTON_DOWN, [](const SDL_Event& ev) {
+ *         ...
+ *     });
+ * }
+ * @endcode
+ */
+class QTSDL_EXPORT QSDLEventBatch: public QEvent
+{
+public:
+    /**
+     * @brief The AxisSamples struct describes the raw axis samples merged into one event by the axis coalescing.
+     */
+    struct AxisSamples {
+        /// The number of merged samples.
+        quint32 samples = 1;
+        /// The SDL timestamp (in nanoseconds) of the first merged sample.
+        Uint64 firstTimestamp = 0;
+    };
+
+    /**
+     * @brief Constructs a batch from the list of drained SDL events.
+     * @param events The SDL events of one polling cycle.
+     */
+    explicit QSDLEventBatch(QList<SDL_Event> events);
+
+    /**
+     * @brief Destroys the batch and records the post-to-delivery latency of its events when it carries metrics.
+     */
+    ~QSDLEventBatch() override;
+
+    /**
+     * @brief Creates a deep copy of the batch.
+     * @return A pointer to a newly allocated `QSDLEventBatch` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns all events of the batch.
+     * @return A constant reference to the contiguous array of SDL events.
+     */
+    const QList<SDL_Event>& events() const;
+
+    /**
+     * @brief Returns the number of events in the batch.
+     * @return The number of events.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Checks whether the batch is empty.
+     * @return true if the batch does not contain any events.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Returns the event at the given position.
+     * @param index The position of the event. Must be less than `size()`.
+     * @return A constant reference to the SDL event.
+     */
+    const SDL_Event& at(qsizetype index) const;
+
+    /**
+     * @brief Returns an iterator to the first event of the batch.
+     */
+    QList<SDL_Event>::const_iterator begin() const;
+
+    /**
+     * @brief Returns an iterator past the last event of the batch.
+     */
+    QList<SDL_Event>::const_iterator end() const;
+
+    /**
+     * @brief Returns the number of events of the given type.
+     * @param type The SDL event type to count.
+     * @return The number of matching events.
+     */
+    qsizetype count(SDL_EventType type) const;
+
+    /**
+     * @brief Calls @a func for each event of the given type in the order of arrival.
+     * @param type The SDL event type to visit.
+     * @param func A callable that takes `const SDL_Event&`.
+     */
+    template<class Func>
+    void forEachOfType(SDL_EventType type, Func&& func) const {
+        for (const SDL_Event& event : _events) {
+            if (event.type == type) {
+                func(event);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls @a func for each event with a type in the range [@a first, @a last].
+     * @param first The first SDL event type of the range.
+     * @param last The last SDL event type of the range.
+     * @param func A callable that takes `const SDL_Event&`.
+     */
+    template<class Func>
+    void forEachOfTypes(SDL_EventType first, SDL_EventType last, Func&& func) const {
+        for (const SDL_Event& event : _events) {
+            if (event.type >= static_cast<Uint32>(first) && event.type <= static_cast<Uint32>(last)) {
+                func(event);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls @a func for each joystick or gamepad event of the given device.
+     * @param device The SDL joystick instance id of the device.
+     * @param func A callable that takes `const SDL_Event&`.
+     */
+    template<class Func>
+    void forEachOfDevice(SDL_JoystickID device, Func&& func) const {
+        for (const SDL_Event& event : _events) {
+            if (isDeviceEvent(event) && event.jdevice.which == device) {
+                func(event);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks whether the event belongs to a joystick or gamepad device.
+     * @param event The SDL event to check.
+     * @return true if the `which` field of the event contains a joystick instance id.
+     */
+    static bool isDeviceEvent(const SDL_Event& event);
+
+    /**
+     * @brief Returns the time at which `SDLEventManager` posted the batch.
+     * @return The time in nanoseconds of `SDL_GetTicksNS()`, or 0 if the batch was not posted by the manager.
+     */
+    Uint64 postedTimestamp() const;
+
+    /**
+     * @brief Marks the batch as posted.
+     * @param timestamp The post time in nanoseconds of `SDL_GetTicksNS()`.
+     * @param metrics The metrics that receive the post-to-delivery latency of the events, or nullptr.
+     */
+    void markPosted(Uint64 timestamp, const std::shared_ptr<SDLEventMetrics>& metrics = {});
+
+    /**
+     * @brief Returns the slot of the device that produced an event of the batch.
+     * @param event The SDL event.
+     * @return The slot, or a null slot if the event does not belong to a gamepad opened by `SDLEventManager`.
+     */
+    DeviceSlot deviceSlot(const SDL_Event& event) const;
+
+    /**
+     * @brief Returns the slot table of the devices at the moment the batch was posted.
+     */
+    const DeviceSlotTable& deviceSlots() const;
+
+    /**
+     * @brief Sets the slot table of the devices.
+     * @param newDeviceSlots The slot table.
+     */
+    void setDeviceSlots(const DeviceSlotTable& newDeviceSlots);
+
+    /**
+     * @brief Returns the number of raw axis samples merged into a gamepad axis event of the batch.
+     *
+     * It is greater than 1 only when `SDLEventManager::setAxisCoalescing()` is enabled.
+     * @param event The `SDL_EVENT_GAMEPAD_AXIS_MOTION` event.
+     * @return The number of merged samples.
+     * @see QSDLGamepadAxisEvent::samples
+     */
+    quint32 samples(const SDL_Event& event) const;
+
+    /**
+     * @brief Returns the SDL timestamp of the first raw sample merged into a gamepad axis event of the batch.
+     * @param event The `SDL_EVENT_GAMEPAD_AXIS_MOTION` event.
+     * @return The timestamp of the first sample, or the timestamp of the event when no samples were merged.
+     * @see QSDLGamepadAxisEvent::firstTimestamp
+     */
+    Uint64 firstTimestamp(const SDL_Event& event) const;
+
+    /**
+     * @brief Returns the merged samples of the axis events of the batch, keyed by `axisKey()`.
+     *
+     * Only the axis events with more than one merged sample are listed.
+     */
+    const QHash<quint64, AxisSamples>& axisSamples() const;
+
+    /**
+     * @brief Sets the merged samples of the axis events of the batch.
+     * @param newAxisSamples The merged samples keyed by `axisKey()`.
+     */
+    void setAxisSamples(const QHash<quint64, AxisSamples>& newAxisSamples);
+
+    /**
+     * @brief Returns the key of the gamepad axis.
+     * @param event The axis motion event.
+     * @return A key unique for each pair of gamepad and axis.
+     */
+    static quint64 axisKey(const SDL_GamepadAxisEvent& event);
+
+private:
+    QList<SDL_Event> _events;
+    Uint64 _postedTimestamp = 0;
+    std::shared_ptr<SDLEventMetrics> _metrics;
+    DeviceSlotTable _deviceSlots;
+    QHash<quint64, AxisSamples> _axisSamples;
+};
+} // namespace QtSDL
+#endif // QSDLEVENTBATCH_H
@@ -0,0 +1,242 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdleventfactory.h"
+#include "qsdlevent.h"
+#include "qsdlgamepadaxisevent.h"
+#include "qsdlgamepadbuttonevent.h"
+#include "qsdlgamepadevent.h"
+#include "qsdlgamepadsensorevent.h"
+#include "qsdlgamepadtouchpadevent.h"
+#include "qsdljoystickaxisevent.h"
+#include "qsdljoystickbuttonevent.h"
+#include "qsdljoystickevent.h"
+#include "qsdljoystickhatevent.h"
+#include "sdleventmanager.h"
+#include <QList>
+#include <QReadWriteLock>
+#include <array>
+#include <atomic>
+
+namespace QtSDL {
+
+namespace {
+
+using Descriptor = QSDLEventFactory::Descriptor;
+
+constexpr Uint32 GAMEPAD_FIRST = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+constexpr Uint32 GAMEPAD_LAST = SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED;
+
+constexpr Uint32 JOYSTICK_FIRST = SDL_EVENT_JOYSTICK_AXIS_MOTION;
+constexpr Uint32 JOYSTICK_LAST = SDL_EVENT_JOYSTICK_UPDATE_COMPLETE;
+
+constexpr Descriptor GENERIC_DESCRIPTOR {&QSDLEventFactory::make<QSDLEvent>,
+                                         SDLEventManager::OtherEvents,
+                                         QSDLEventFactory::NoValidation};
+
+/**
+ * @brief The descriptors of the gamepad events, indexed by `type - GAMEPAD_FIRST`.
+ */
+constexpr auto GAMEPAD_TABLE = [] {
+    std::array<Descriptor, GAMEPAD_LAST - GAMEPAD_FIRST + 1> table {};
+    table.fill(GENERIC_DESCRIPTOR);
+
+    auto set = [&table](Uint32 type, QSDLEventFactory::Creator create, quint32 group,
+                        QSDLEventFactory::Validation validation) {
+        table[type - GAMEPAD_FIRST] = {create, group, validation};
+    };
+
+    set(SDL_EVENT_GAMEPAD_ADDED, &QSDLEventFactory::make<QSDLGamepadEvent>,
+        SDLEventManager::GamepadDevice, QSDLEventFactory::NoValidation);
+    set(SDL_EVENT_GAMEPAD_REMOVED, &QSDLEventFactory::make<QSDLGamepadEvent>,
+        SDLEventManager::GamepadDevice, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_GAMEPAD_REMAPPED, &QSDLEventFactory::make<QSDLGamepadEvent>,
+        SDLEventManager::GamepadDevice, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_GAMEPAD_UPDATE_COMPLETE, &QSDLEventFactory::make<QSDLGamepadEvent>,
+        SDLEventManager::GamepadDevice, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED, &QSDLEventFactory::make<QSDLGamepadEvent>,
+        SDLEventManager::GamepadDevice, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_GAMEPAD_AXIS_MOTION, &QSDLEventFactory::make<QSDLGamepadAxisEvent>,
+        SDLEventManager::GamepadAxis, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_GAMEPAD_BUTTON_DOWN, &QSDLEventFactory::make<QSDLGamepadButtonEvent>,
+        SDLEventManager::GamepadButton, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_GAMEPAD_BUTTON_UP, &QSDLEventFactory::make<QSDLGamepadButtonEvent>,
+        SDLEventManager::GamepadButton, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN, &QSDLEventFactory::make<QSDLGamepadTouchpadEvent>,
+        SDLEventManager::GamepadTouchpad, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION, &QSDLEventFactory::make<QSDLGamepadTouchpadEvent>,
+        SDLEventManager::GamepadTouchpad, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_GAMEPAD_TOUCHPAD_UP, &QSDLEventFactory::make<QSDLGamepadTouchpadEvent>,
+        SDLEventManager::GamepadTouchpad, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_GAMEPAD_SENSOR_UPDATE, &QSDLEventFactory::make<QSDLGamepadSensorEvent>,
+        SDLEventManager::GamepadSensor, QSDLEventFactory::RequiresOpenedDevice);
+
+    return table;
+}();
+
+/**
+ * @brief The descriptors of the joystick events, indexed by `type - JOYSTICK_FIRST`.
+ *
+ * Joysticks of gamepads are opened together with the gamepads, so the events of any opened device pass the validation.
+ */
+constexpr auto JOYSTICK_TABLE = [] {
+    std::array<Descriptor, JOYSTICK_LAST - JOYSTICK_FIRST + 1> table {};
+    table.fill(GENERIC_DESCRIPTOR);
+
+    auto set = [&table](Uint32 type, QSDLEventFactory::Creator create, quint32 group,
+                        QSDLEventFactory::Validation validation) {
+        table[type - JOYSTICK_FIRST] = {create, group, validation};
+    };
+
+    set(SDL_EVENT_JOYSTICK_ADDED, &QSDLEventFactory::make<QSDLJoystickEvent>,
+        SDLEventManager::JoystickDevice, QSDLEventFactory::NoValidation);
+    set(SDL_EVENT_JOYSTICK_REMOVED, &QSDLEventFactory::make<QSDLJoystickEvent>,
+        SDLEventManager::JoystickDevice, QSDLEventFactory::NoValidation);
+    set(SDL_EVENT_JOYSTICK_BATTERY_UPDATED, &QSDLEventFactory::make<QSDLEvent>,
+        SDLEventManager::JoystickDevice, QSDLEventFactory::NoValidation);
+    set(SDL_EVENT_JOYSTICK_UPDATE_COMPLETE, &QSDLEventFactory::make<QSDLJoystickEvent>,
+        SDLEventManager::JoystickDevice, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_JOYSTICK_AXIS_MOTION, &QSDLEventFactory::make<QSDLJoystickAxisEvent>,
+        SDLEventManager::JoystickAxis, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_JOYSTICK_BALL_MOTION, &QSDLEventFactory::make<QSDLEvent>,
+        SDLEventManager::JoystickAxis, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_JOYSTICK_BUTTON_DOWN, &QSDLEventFactory::make<QSDLJoystickButtonEvent>,
+        SDLEventManager::JoystickButton, QSDLEventFactory::RequiresOpenedDevice);
+    set(SDL_EVENT_JOYSTICK_BUTTON_UP, &QSDLEventFactory::make<QSDLJoystickButtonEvent>,
+        SDLEventManager::JoystickButton, QSDLEventFactory::RequiresOpenedDevice);
+
+    set(SDL_EVENT_JOYSTICK_HAT_MOTION, &QSDLEventFactory::make<QSDLJoystickHatEvent>,
+        SDLEventManager::JoystickHat, QSDLEventFactory::RequiresOpenedDevice);
+
+    return table;
+}();
+
+/**
+ * @brief The UserRange struct is a range of user event types registered in the factory.
+ */
+struct UserRange {
+    Uint32 first;
+    Uint32 count;
+    QSDLEventFactory::Creator create;
+};
+
+QReadWriteLock g_userLock;
+QList<UserRange> g_userRanges;
+std::atomic<bool> g_hasUserRanges {false};
+
+/**
+ * @brief The user event types reserved in SDL. SDL never releases them, so the list only grows.
+ */
+QList<QSDLEventFactory::TypeRange> g_registeredRanges;
+std::atomic<quint32> g_registeredRevision {0};
+
+/**
+ * @brief Remembers a range of reserved user event types. Call it with g_userLock locked for writing.
+ */
+void rememberRange(Uint32 first, Uint32 count) {
+    for (const QSDLEventFactory::TypeRange& range : std::as_const(g_registeredRanges)) {
+        if (first - range.first < range.count && first + count - 1 - range.first < range.count) {
+            return;
+        }
+    }
+
+    g_registeredRanges.append({first, count});
+    g_registeredRevision.fetch_add(1, std::memory_order_release);
+}
+
+QSDLEventFactory::Creator findUserCreator(Uint32 type) {
+    QReadLocker locker(&g_userLock);
+    for (const UserRange& range : std::as_const(g_userRanges)) {
+        if (type - range.first < range.count) {
+            return range.create;
+        }
+    }
+
+    return nullptr;
+}
+}
+
+const QSDLEventFactory::Descriptor &QSDLEventFactory::descriptor(Uint32 type) {
+    // The unsigned subtraction also rejects the types below the gamepad range.
+    if (type - GAMEPAD_FIRST < GAMEPAD_TABLE.size()) {
+        return GAMEPAD_TABLE[type - GAMEPAD_FIRST];
+    }
+
+    if (type - JOYSTICK_FIRST < JOYSTICK_TABLE.size()) {
+        return JOYSTICK_TABLE[type - JOYSTICK_FIRST];
+    }
+
+    return GENERIC_DESCRIPTOR;
+}
+
+QSDLEvent *QSDLEventFactory::create(const SDL_Event &event) {
+    if (event.type >= SDL_EVENT_USER && g_hasUserRanges.load(std::memory_order_acquire)) {
+        if (Creator create = findUserCreator(event.type)) {
+            return create(event);
+        }
+    }
+
+    return descriptor(event.type).create(event);
+}
+
+bool QSDLEventFactory::registerUserType(Uint32 first, Uint32 count, Creator create) {
+    if (!create || !count || first < SDL_EVENT_USER || first + count - 1 > SDL_EVENT_LAST ||
+        first + count - 1 < first) {
+        return false;
+    }
+
+    QWriteLocker locker(&g_userLock);
+    for (const UserRange& range : std::as_const(g_userRanges)) {
+        if (first < range.first + range.count && range.first < first + count) {
+            return false;
+        }
+    }
+
+    g_userRanges.append({first, count, create});
+    g_hasUserRanges.store(true, std::memory_order_release);
+    rememberRange(first, count);
+    return true;
+}
+
+void QSDLEventFactory::unregisterUserType(Uint32 first) {
+    QWriteLocker locker(&g_userLock);
+    g_userRanges.removeIf([first](const UserRange& range) {
+        return range.first == first;
+    });
+    g_hasUserRanges.store(!g_userRanges.isEmpty(), std::memory_order_release);
+}
+
+Uint32 QSDLEventFactory::registerEvents(int count) {
+    if (count <= 0) {
+        return 0;
+    }
+
+    const Uint32 first = SDL_RegisterEvents(count);
+    if (!first) {
+        return 0;
+    }
+
+    QWriteLocker locker(&g_userLock);
+    rememberRange(first, static_cast<Uint32>(count));
+    return first;
+}
+
+QList<QSDLEventFactory::TypeRange> QSDLEventFactory::registeredEvents() {
+    QReadLocker locker(&g_userLock);
+    return g_registeredRanges;
+}
+
+quint32 QSDLEventFactory::registeredEventsRevision() {
+    return g_registeredRevision.load(std::memory_order_acquire);
+}
+}
@@ -0,0 +1,158 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLEVENTFACTORY_H
+#define QSDLEVENTFACTORY_H
+
+#include <QList>
+#include <SDL3/SDL.h>
+#include "global.h"
+
+namespace QtSDL {
+
+class QSDLEvent;
+
+/**
+ * @brief The QSDLEventFactory class wraps raw SDL events into the matching `QSDLEvent` classes.
+ *
+ * The wrapper class, the subscription group and the validation policy of each built-in
+ * event type are kept in a compile-time table. The gamepad event types form a dense range,
+ * so the lookup is a single indexed load instead of a chain of comparisons.
+ *
+ * Applications may register their own wrapper classes for the event types reserved with
+ * `SDL_RegisterEvents()`. Such events are routed as `SDLEventManager::OtherEvents`.
+ *
+ * @code{cpp}
+ * const Uint32 type = QtSDL::QSDLEventFactory::registerEvents(1);
+ * QtSDL::QSDLEventFactory::registerUserType<MyEvent>(type);
+ * @endcode
+ */
+class QTSDL_EXPORT QSDLEventFactory
+{
+public:
+    /**
+     * @brief A function that allocates the wrapper of an SDL event.
+     */
+    using Creator = QSDLEvent* (*)(const SDL_Event& event);
+
+    /**
+     * @brief The Validation enum defines the checks applied to an event before it is wrapped.
+     */
+    enum Validation: quint8 {
+        /// The event is not checked.
+        NoValidation,
+        /// The event must belong to a gamepad opened by the manager.
+        RequiresOpenedDevice
+    };
+
+    /**
+     * @brief The Descriptor struct describes how an SDL event type is processed.
+     */
+    struct Descriptor {
+        /// Allocates the wrapper of the event.
+        Creator create;
+        /// The `SDLEventManager::EventTypeFlag` group used to route the event.
+        quint32 group;
+        /// The checks applied to the event.
+        Validation validation;
+    };
+
+    /**
+     * @brief Returns the descriptor of a built-in SDL event type.
+     * @param type The SDL event type.
+     * @return The descriptor. Unknown types are wrapped into a generic `QSDLEvent`.
+     */
+    static const Descriptor& descriptor(Uint32 type);
+
+    /**
+     * @brief Wraps an SDL event into its QSDLEvent class.
+     *
+     * Event types registered with `registerUserType()` are wrapped by their registered creator.
+     * @param event The SDL event to wrap.
+     * @return A new event object. The ownership is passed to the caller.
+     */
+    static QSDLEvent* create(const SDL_Event& event);
+
+    /**
+     * @brief Registers a creator for a range of user event types.
+     *
+     * This method is thread-safe.
+     * @param first The first event type of the range, as returned by `SDL_RegisterEvents()`.
+     * @param count The number of event types in the range.
+     * @param create The function that allocates the wrappers.
+     * @return true if the range was registered, false if it is not a user range or overlaps another registration.
+     */
+    static bool registerUserType(Uint32 first, Uint32 count, Creator create);
+
+    /**
+     * @brief Registers a wrapper class for a range of user event types.
+     *
+     * The class must derive from `QSDLEvent` and provide the `(SDL_Event, SDL_EventType)` constructor.
+     * @param first The first event type of the range, as returned by `SDL_RegisterEvents()`.
+     * @param count The number of event types in the range.
+     * @return true if the range was registered.
+     */
+    template<class T>
+    static bool registerUserType(Uint32 first, Uint32 count = 1) {
+        return registerUserType(first, count, &make<T>);
+    }
+
+    /**
+     * @brief Removes the registration of the user range that starts with @a first.
+     * @param first The first event type of the registered range.
+     */
+    static void unregisterUserType(Uint32 first);
+
+    /**
+     * @brief The TypeRange struct is a range of event types reserved with `SDL_RegisterEvents()`.
+     */
+    struct TypeRange {
+        /// The first event type of the range.
+        Uint32 first;
+        /// The number of event types in the range.
+        Uint32 count;
+    };
+
+    /**
+     * @brief Reserves user event types with `SDL_RegisterEvents()` and remembers them.
+     *
+     * `SDLEventManager::UserEvents` toggles only the remembered types, so reserve the types
+     * with this method instead of calling `SDL_RegisterEvents()` directly.
+     * The ranges passed to `registerUserType()` are remembered too.
+     *
+     * This method is thread-safe.
+     * @param count The number of event types to reserve.
+     * @return The first reserved event type, or 0 if SDL has no free types left.
+     */
+    static Uint32 registerEvents(int count = 1);
+
+    /**
+     * @brief Returns all user event types remembered by `registerEvents()` and `registerUserType()`.
+     *
+     * This method is thread-safe.
+     * @return The ranges in the order of registration.
+     */
+    static QList<TypeRange> registeredEvents();
+
+    /**
+     * @brief Returns a counter that changes each time new user event types are remembered.
+     */
+    static quint32 registeredEventsRevision();
+
+    /**
+     * @brief Allocates a wrapper of class @a T for the event.
+     * @param event The SDL event to wrap.
+     * @return A new event object.
+     */
+    template<class T>
+    static QSDLEvent* make(const SDL_Event& event) {
+        return new T(event, static_cast<SDL_EventType>(event.type));
+    }
+};
+} // namespace QtSDL
+#endif // QSDLEVENTFACTORY_H
@@ -0,0 +1,155 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdleventpool.h"
+#include <atomic>
+#include <new>
+
+namespace QtSDL {
+
+namespace {
+
+/**
+ * @brief The size of one pool block. It must fit the largest class of the QSDLEvent hierarchy.
+ */
+constexpr std::size_t BLOCK_SIZE = 256;
+
+struct Node {
+    Node* next;
+};
+
+std::atomic<Node*> g_returned {nullptr};
+std::atomic<std::size_t> g_cached {0};
+std::atomic<std::size_t> g_maxCached {1024};
+
+std::atomic<quint64> g_hits {0};
+std::atomic<quint64> g_misses {0};
+std::atomic<quint64> g_live {0};
+std::atomic<quint64> g_peakLive {0};
+
+void pushReturned(Node* first, Node* last) {
+    Node* head = g_returned.load(std::memory_order_relaxed);
+    do {
+        last->next = head;
+    } while (!g_returned.compare_exchange_weak(head, first,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+}
+
+/**
+ * @brief The LocalCache struct is the private free list of the allocating thread.
+ */
+struct LocalCache {
+    Node* head = nullptr;
+
+    ~LocalCache() {
+        if (!head) {
+            return;
+        }
+
+        Node* last = head;
+        while (last->next) {
+            last = last->next;
+        }
+
+        pushReturned(head, last);
+    }
+};
+
+thread_local LocalCache t_cache;
+
+void updatePeak(quint64 live) {
+    quint64 peak = g_peakLive.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !g_peakLive.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+}
+
+void *QSDLEventPool::allocate(std::size_t size) {
+    updatePeak(g_live.fetch_add(1, std::memory_order_relaxed) + 1);
+
+    if (size > BLOCK_SIZE) {
+        g_misses.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    if (!t_cache.head) {
+        t_cache.head = g_returned.exchange(nullptr, std::memory_order_acquire);
+    }
+
+    if (Node* node = t_cache.head) {
+        t_cache.head = node->next;
+        g_cached.fetch_sub(1, std::memory_order_relaxed);
+        g_hits.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    g_misses.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(BLOCK_SIZE);
+}
+
+void QSDLEventPool::release(void *ptr, std::size_t size) {
+    if (!ptr) {
+        return;
+    }
+
+    g_live.fetch_sub(1, std::memory_order_relaxed);
+
+    if (size > BLOCK_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    if (g_cached.fetch_add(1, std::memory_order_relaxed) >= g_maxCached.load(std::memory_order_relaxed)) {
+        g_cached.fetch_sub(1, std::memory_order_relaxed);
+        ::operator delete(ptr);
+        return;
+    }
+
+    Node* node = static_cast<Node*>(ptr);
+    pushReturned(node, node);
+}
+
+QSDLEventPoolStats QSDLEventPool::stats() {
+    QSDLEventPoolStats result;
+    result.hits = g_hits.load(std::memory_order_relaxed);
+    result.misses = g_misses.load(std::memory_order_relaxed);
+    result.live = g_live.load(std::memory_order_relaxed);
+    result.peakLive = g_peakLive.load(std::memory_order_relaxed);
+    result.cached = g_cached.load(std::memory_order_relaxed);
+    return result;
+}
+
+void QSDLEventPool::resetStats() {
+    g_hits.store(0, std::memory_order_relaxed);
+    g_misses.store(0, std::memory_order_relaxed);
+    g_peakLive.store(g_live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::size_t QSDLEventPool::blockSize() {
+    return BLOCK_SIZE;
+}
+
+std::size_t QSDLEventPool::maxCached() {
+    return g_maxCached.load(std::memory_order_relaxed);
+}
+
+void QSDLEventPool::setMaxCached(std::size_t newMaxCached) {
+    g_maxCached.store(newMaxCached, std::memory_order_relaxed);
+}
+
+void QSDLEventPool::trim() {
+    Node* node = g_returned.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        Node* next = node->next;
+        ::operator delete(node);
+        g_cached.fetch_sub(1, std::memory_order_relaxed);
+        node = next;
+    }
+}
+}
@@ -0,0 +1,104 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLEVENTPOOL_H
+#define QSDLEVENTPOOL_H
+
+#include <cstddef>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLEventPoolStats struct contains the usage counters of the `QSDLEventPool`.
+ */
+struct QSDLEventPoolStats {
+    /// The number of allocations served from the free list.
+    quint64 hits = 0;
+    /// The number of allocations that required a new memory block.
+    quint64 misses = 0;
+    /// The number of events that are currently alive.
+    quint64 live = 0;
+    /// The maximum number of events that were alive at the same time.
+    quint64 peakLive = 0;
+    /// The number of free blocks currently cached by the pool.
+    quint64 cached = 0;
+};
+
+/**
+ * @brief The QSDLEventPool class is a class-level free-list allocator for the `QSDLEvent` hierarchy.
+ *
+ * Events are allocated on the `SDLEventManager` thread and released on the thread that
+ * handles them, so the pool is built for one allocating thread and any number of
+ * releasing threads:
+ *
+ * - released blocks are pushed to a shared lock-free stack;
+ * - the allocating thread takes the whole shared stack at once into its own thread-local
+ *   free list, and then pops blocks from that list without any synchronization.
+ *
+ * This scheme never pops single nodes from the shared stack, so it is free from the ABA problem.
+ * Allocations larger than `blockSize()` bypass the pool and use the global allocator.
+ *
+ * @note You do not need to use this class directly. `QSDLEvent` overrides its `operator new`
+ * and `operator delete` to use the pool. Use `stats()` to size the pool in production.
+ */
+class QTSDL_EXPORT QSDLEventPool
+{
+public:
+    /**
+     * @brief Allocates a memory block for an event.
+     * @param size The required size in bytes.
+     * @return A pointer to the allocated memory.
+     */
+    static void* allocate(std::size_t size);
+
+    /**
+     * @brief Returns a memory block back to the pool.
+     * @param ptr The pointer returned by `allocate()`.
+     * @param size The size passed to `allocate()`.
+     */
+    static void release(void* ptr, std::size_t size);
+
+    /**
+     * @brief Returns a snapshot of the pool usage counters.
+     * @return The pool counters.
+     */
+    static QSDLEventPoolStats stats();
+
+    /**
+     * @brief Resets the hit, miss and peak counters. The live and cached counters are kept.
+     */
+    static void resetStats();
+
+    /**
+     * @brief Returns the size of the pool blocks in bytes.
+     * @return The size of one block.
+     */
+    static std::size_t blockSize();
+
+    /**
+     * @brief Returns the maximum number of free blocks kept by the pool.
+     * @return The limit of the free list. The default is 1024.
+     */
+    static std::size_t maxCached();
+
+    /**
+     * @brief Sets the maximum number of free blocks kept by the pool.
+     *
+     * Blocks released while the pool is full are returned to the global allocator.
+     * @param newMaxCached The new limit of the free list.
+     */
+    static void setMaxCached(std::size_t newMaxCached);
+
+    /**
+     * @brief Returns all free blocks of the shared stack to the global allocator.
+     */
+    static void trim();
+};
+} // namespace QtSDL
+#endif // QSDLEVENTPOOL_H
@@ -6,14 +6,44 @@
 //#
 
 #include "qsdlgamepadaxisevent.h"
+#include <algorithm>
 
 namespace QtSDL {
 
 
-QSDLGamepadAxisEvent::QSDLGamepadAxisEvent(SDL_Event event, SDL_EventType type):QSDLEvent(event, type)  {}
+QSDLGamepadAxisEvent::QSDLGamepadAxisEvent(SDL_Event event, SDL_EventType type):QSDLEvent(event, type)  {
+    _firstTimestamp = event.gaxis.timestamp;
+}
 
 const SDL_GamepadAxisEvent &QSDLGamepadAxisEvent::sdlEvent() const {
     return data().gaxis;
 }
 
+QEvent *QSDLGamepadAxisEvent::clone() const {
+    auto result = new QSDLGamepadAxisEvent(data(), sdlType());
+    result->setCoalescedSamples(_samples, _firstTimestamp);
+    return result;
+}
+
+float QSDLGamepadAxisEvent::normalizedValue() const {
+    return std::max(data().gaxis.value / 32767.0f, -1.0f);
+}
+
+quint32 QSDLGamepadAxisEvent::samples() const {
+    return _samples;
+}
+
+Uint64 QSDLGamepadAxisEvent::firstTimestamp() const {
+    return _firstTimestamp;
+}
+
+Uint64 QSDLGamepadAxisEvent::lastTimestamp() const {
+    return data().gaxis.timestamp;
+}
+
+void QSDLGamepadAxisEvent::setCoalescedSamples(quint32 samples, Uint64 firstTimestamp) {
+    _samples = samples;
+    _firstTimestamp = firstTimestamp;
+}
+
 }
@@ -55,6 +55,54 @@ public:
      * details about the axis motion.
      */
     const SDL_GamepadAxisEvent &sdlEvent() const;
+
+    /**
+     * @brief Creates a deep copy of the event, including the coalescing data.
+     * @return A pointer to a newly allocated `QSDLGamepadAxisEvent` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns the value of the axis normalized to the [-1, 1] range (triggers use [0, 1]).
+     *
+     * When `SDLEventManager::setAxisFilterEnabled()` is enabled, the value already has
+     * the deadzone and the response curve applied.
+     * @return The normalized value.
+     */
+    float normalizedValue() const;
+
+    /**
+     * @brief Returns the number of raw axis samples merged into this event.
+     *
+     * It is greater than 1 only when `SDLEventManager::setAxisCoalescing()` is enabled.
+     * @return The number of merged samples.
+     */
+    quint32 samples() const;
+
+    /**
+     * @brief Returns the SDL timestamp (in nanoseconds) of the first merged sample.
+     * @return The timestamp of the first sample.
+     */
+    Uint64 firstTimestamp() const;
+
+    /**
+     * @brief Returns the SDL timestamp (in nanoseconds) of the last merged sample.
+     *
+     * The value of the event always belongs to this sample.
+     * @return The timestamp of the last sample.
+     */
+    Uint64 lastTimestamp() const;
+
+    /**
+     * @brief Sets the coalescing data of the event.
+     * @param samples The number of merged samples.
+     * @param firstTimestamp The SDL timestamp of the first merged sample.
+     */
+    void setCoalescedSamples(quint32 samples, Uint64 firstTimestamp);
+
+private:
+    quint32 _samples = 1;
+    Uint64 _firstTimestamp = 0;
 };
 } // namespace QtSDL
 #endif // QSDLGAMEPADAXISEVENT_H
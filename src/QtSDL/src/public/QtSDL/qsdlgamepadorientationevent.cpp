@@ -0,0 +1,33 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdlgamepadorientationevent.h"
+#include "qsdlevent.h"
+
+namespace QtSDL {
+
+QSDLGamepadOrientationEvent::QSDLGamepadOrientationEvent(const OrientationState &state):
+    QEvent(static_cast<QEvent::Type>(QSDLEvent::SDLOrientationType)),
+    _state(state) {
+}
+
+QEvent *QSDLGamepadOrientationEvent::clone() const {
+    return new QSDLGamepadOrientationEvent(_state);
+}
+
+SDL_JoystickID QSDLGamepadOrientationEvent::device() const {
+    return _state.device;
+}
+
+DeviceSlot QSDLGamepadOrientationEvent::deviceSlot() const {
+    return _state.slot;
+}
+
+const OrientationState &QSDLGamepadOrientationEvent::state() const {
+    return _state;
+}
+}
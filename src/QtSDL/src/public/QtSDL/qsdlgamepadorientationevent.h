@@ -0,0 +1,59 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLGAMEPADORIENTATIONEVENT_H
+#define QSDLGAMEPADORIENTATIONEVENT_H
+
+#include <QEvent>
+#include "gamepadorientationfilter.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLGamepadOrientationEvent class delivers the fused orientation of one gamepad.
+ *
+ * When `SDLEventManager::setOrientationFusion()` is enabled, the gyroscope and accelerometer samples
+ * of each gamepad are fused into an `OrientationState` on the manager thread. At most one
+ * QSDLGamepadOrientationEvent per gamepad is posted per publish period.
+ */
+class QTSDL_EXPORT QSDLGamepadOrientationEvent: public QEvent
+{
+public:
+    /**
+     * @brief Constructs an orientation event.
+     * @param state The fused orientation of the gamepad.
+     */
+    explicit QSDLGamepadOrientationEvent(const OrientationState& state);
+
+    /**
+     * @brief Creates a deep copy of the event.
+     * @return A pointer to a newly allocated `QSDLGamepadOrientationEvent` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns the SDL joystick instance id of the gamepad.
+     */
+    SDL_JoystickID device() const;
+
+    /**
+     * @brief Returns the slot of the gamepad.
+     */
+    DeviceSlot deviceSlot() const;
+
+    /**
+     * @brief Returns the fused orientation of the gamepad.
+     */
+    const OrientationState& state() const;
+
+private:
+    OrientationState _state;
+};
+} // namespace QtSDL
+#endif // QSDLGAMEPADORIENTATIONEVENT_H
@@ -0,0 +1,62 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdlgamepadsensorblockevent.h"
+#include "qsdlevent.h"
+
+namespace QtSDL {
+
+QSDLGamepadSensorBlockEvent::QSDLGamepadSensorBlockEvent(SDL_JoystickID device, SDL_SensorType sensor,
+                                                         QList<Uint64> timestamps,
+                                                         QList<float> x, QList<float> y, QList<float> z,
+                                                         quint64 dropped):
+    QEvent(static_cast<QEvent::Type>(QSDLEvent::SDLSensorBlockType)),
+    _device(device),
+    _sensor(sensor),
+    _timestamps(std::move(timestamps)),
+    _x(std::move(x)),
+    _y(std::move(y)),
+    _z(std::move(z)),
+    _dropped(dropped) {
+}
+
+QEvent *QSDLGamepadSensorBlockEvent::clone() const {
+    return new QSDLGamepadSensorBlockEvent(_device, _sensor, _timestamps, _x, _y, _z, _dropped);
+}
+
+SDL_JoystickID QSDLGamepadSensorBlockEvent::device() const {
+    return _device;
+}
+
+SDL_SensorType QSDLGamepadSensorBlockEvent::sensor() const {
+    return _sensor;
+}
+
+qsizetype QSDLGamepadSensorBlockEvent::size() const {
+    return _timestamps.size();
+}
+
+const QList<Uint64> &QSDLGamepadSensorBlockEvent::timestamps() const {
+    return _timestamps;
+}
+
+const QList<float> &QSDLGamepadSensorBlockEvent::x() const {
+    return _x;
+}
+
+const QList<float> &QSDLGamepadSensorBlockEvent::y() const {
+    return _y;
+}
+
+const QList<float> &QSDLGamepadSensorBlockEvent::z() const {
+    return _z;
+}
+
+quint64 QSDLGamepadSensorBlockEvent::dropped() const {
+    return _dropped;
+}
+}
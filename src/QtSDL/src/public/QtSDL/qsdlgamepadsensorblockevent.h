@@ -0,0 +1,105 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#ifndef QSDLGAMEPADSENSORBLOCKEVENT_H
+#define QSDLGAMEPADSENSORBLOCKEVENT_H
+
+#include <QEvent>
+#include <QList>
+#include <SDL3/SDL.h>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLGamepadSensorBlockEvent class delivers a block of samples of one gamepad sensor.
+ *
+ * When `SDLEventManager::setSensorBlockDelivery()` is enabled, the manager writes each
+ * `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` into a per-device, per-sensor ring buffer instead of
+ * posting a `QSDLGamepadSensorEvent`. The buffered samples are posted as one
+ * QSDLGamepadSensorBlockEvent every `SDLEventManager::sensorBlockInterval()` milliseconds.
+ *
+ * The samples are stored as a structure of arrays: `timestamps()`, `x()`, `y()` and `z()`
+ * have the same length and are ordered from the oldest to the newest sample.
+ */
+class QTSDL_EXPORT QSDLGamepadSensorBlockEvent: public QEvent
+{
+public:
+    /**
+     * @brief Constructs a block event.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param sensor The type of the sensor.
+     * @param timestamps The timestamps of the samples in nanoseconds.
+     * @param x The first values of the samples.
+     * @param y The second values of the samples.
+     * @param z The third values of the samples.
+     * @param dropped The number of samples lost because the ring buffer overflowed.
+     */
+    QSDLGamepadSensorBlockEvent(SDL_JoystickID device, SDL_SensorType sensor,
+                                QList<Uint64> timestamps,
+                                QList<float> x, QList<float> y, QList<float> z,
+                                quint64 dropped = 0);
+
+    /**
+     * @brief Creates a deep copy of the event.
+     * @return A pointer to a newly allocated `QSDLGamepadSensorBlockEvent` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns the SDL joystick instance id of the gamepad.
+     */
+    SDL_JoystickID device() const;
+
+    /**
+     * @brief Returns the type of the sensor, for example `SDL_SENSOR_GYRO` or `SDL_SENSOR_ACCEL`.
+     */
+    SDL_SensorType sensor() const;
+
+    /**
+     * @brief Returns the number of samples in the block.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Returns the timestamps of the samples in nanoseconds.
+     *
+     * The sensor timestamp is used when the device provides it, otherwise the SDL event timestamp.
+     */
+    const QList<Uint64>& timestamps() const;
+
+    /**
+     * @brief Returns the first values of the samples (the X axis for the gyroscope and accelerometer).
+     */
+    const QList<float>& x() const;
+
+    /**
+     * @brief Returns the second values of the samples (the Y axis for the gyroscope and accelerometer).
+     */
+    const QList<float>& y() const;
+
+    /**
+     * @brief Returns the third values of the samples (the Z axis for the gyroscope and accelerometer).
+     */
+    const QList<float>& z() const;
+
+    /**
+     * @brief Returns the number of samples lost because the ring buffer overflowed before this block.
+     */
+    quint64 dropped() const;
+
+private:
+    SDL_JoystickID _device;
+    SDL_SensorType _sensor;
+    QList<Uint64> _timestamps;
+    QList<float> _x;
+    QList<float> _y;
+    QList<float> _z;
+    quint64 _dropped;
+};
+} // namespace QtSDL
+#endif // QSDLGAMEPADSENSORBLOCKEVENT_H
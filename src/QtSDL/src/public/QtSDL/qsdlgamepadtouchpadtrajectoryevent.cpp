@@ -0,0 +1,36 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdlgamepadtouchpadtrajectoryevent.h"
+#include "qsdlevent.h"
+
+namespace QtSDL {
+
+QSDLGamepadTouchpadTrajectoryEvent::QSDLGamepadTouchpadTrajectoryEvent(SDL_JoystickID device, DeviceSlot slot,
+                                                                       QList<TouchpadTrajectory> trajectories):
+    QEvent(static_cast<QEvent::Type>(QSDLEvent::SDLTouchpadTrajectoryType)),
+    _device(device),
+    _slot(slot),
+    _trajectories(std::move(trajectories)) {
+}
+
+QEvent *QSDLGamepadTouchpadTrajectoryEvent::clone() const {
+    return new QSDLGamepadTouchpadTrajectoryEvent(_device, _slot, _trajectories);
+}
+
+SDL_JoystickID QSDLGamepadTouchpadTrajectoryEvent::device() const {
+    return _device;
+}
+
+DeviceSlot QSDLGamepadTouchpadTrajectoryEvent::deviceSlot() const {
+    return _slot;
+}
+
+const QList<TouchpadTrajectory> &QSDLGamepadTouchpadTrajectoryEvent::trajectories() const {
+    return _trajectories;
+}
+}
@@ -0,0 +1,67 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLGAMEPADTOUCHPADTRAJECTORYEVENT_H
+#define QSDLGAMEPADTOUCHPADTRAJECTORYEVENT_H
+
+#include <QEvent>
+#include <QList>
+#include <SDL3/SDL.h>
+#include "deviceslot.h"
+#include "gamepadtouchpadtracker.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLGamepadTouchpadTrajectoryEvent class delivers the finger trajectories of one gamepad touchpad.
+ *
+ * When `SDLEventManager::setTouchpadTracking()` is enabled, the touchpad events of each gamepad are
+ * folded into per-finger `TouchpadTrajectory` polylines instead of being posted one by one. The
+ * trajectories of all fingers of a gamepad that changed during a polling cycle are posted together
+ * in one QSDLGamepadTouchpadTrajectoryEvent.
+ */
+class QTSDL_EXPORT QSDLGamepadTouchpadTrajectoryEvent: public QEvent
+{
+public:
+    /**
+     * @brief Constructs a trajectory event.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param slot The slot of the gamepad.
+     * @param trajectories The trajectories of the fingers that changed during the cycle.
+     */
+    QSDLGamepadTouchpadTrajectoryEvent(SDL_JoystickID device, DeviceSlot slot, QList<TouchpadTrajectory> trajectories);
+
+    /**
+     * @brief Creates a deep copy of the event.
+     * @return A pointer to a newly allocated `QSDLGamepadTouchpadTrajectoryEvent` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns the SDL joystick instance id of the gamepad.
+     */
+    SDL_JoystickID device() const;
+
+    /**
+     * @brief Returns the slot of the gamepad.
+     */
+    DeviceSlot deviceSlot() const;
+
+    /**
+     * @brief Returns the trajectories of the fingers that changed during the cycle.
+     */
+    const QList<TouchpadTrajectory>& trajectories() const;
+
+private:
+    SDL_JoystickID _device;
+    DeviceSlot _slot;
+    QList<TouchpadTrajectory> _trajectories;
+};
+} // namespace QtSDL
+#endif // QSDLGAMEPADTOUCHPADTRAJECTORYEVENT_H
@@ -0,0 +1,40 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLJOYSTICKAXISEVENT_H
+#define QSDLJOYSTICKAXISEVENT_H
+
+#include "QtSDL/qsdlevent.h" // Base class for custom SDL events in Qt
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLJoystickAxisEvent class encapsulates an SDL joystick axis event.
+ *
+ * This class wraps the `SDL_JoyAxisEvent` structure (`SDL_EVENT_JOYSTICK_AXIS_MOTION`).
+ * Raw joystick axes have no fixed meaning: the axis index and the value range from
+ * `SDL_JOYSTICK_AXIS_MIN` to `SDL_JOYSTICK_AXIS_MAX` are reported as the device sends them.
+ */
+class QTSDL_EXPORT QSDLJoystickAxisEvent: public QSDLEvent
+{
+public:
+    /**
+     * @brief Constructs a QSDLJoystickAxisEvent object.
+     * @param event The raw `SDL_Event` structure containing the joystick data.
+     * @param type The specific `SDL_EventType`, `SDL_EVENT_JOYSTICK_AXIS_MOTION`.
+     */
+    QSDLJoystickAxisEvent(SDL_Event event, SDL_EventType type);
+
+    /**
+     * @brief Provides direct access to the native `SDL_JoyAxisEvent` data.
+     * @return A constant reference to the underlying `SDL_JoyAxisEvent` structure with the axis data such as `axis` and `value`.
+     */
+    const SDL_JoyAxisEvent &sdlEvent() const;
+};
+} // namespace QtSDL
+#endif // QSDLJOYSTICKAXISEVENT_H
@@ -0,0 +1,39 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLJOYSTICKBUTTONEVENT_H
+#define QSDLJOYSTICKBUTTONEVENT_H
+
+#include "QtSDL/qsdlevent.h" // Base class for custom SDL events in Qt
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLJoystickButtonEvent class encapsulates an SDL joystick button event.
+ *
+ * This class wraps the `SDL_JoyButtonEvent` structure (`SDL_EVENT_JOYSTICK_BUTTON_DOWN`
+ * and `SDL_EVENT_JOYSTICK_BUTTON_UP`).
+ */
+class QTSDL_EXPORT QSDLJoystickButtonEvent: public QSDLEvent
+{
+public:
+    /**
+     * @brief Constructs a QSDLJoystickButtonEvent object.
+     * @param event The raw `SDL_Event` structure containing the joystick data.
+     * @param type The specific `SDL_EventType`, `SDL_EVENT_JOYSTICK_BUTTON_DOWN` or `SDL_EVENT_JOYSTICK_BUTTON_UP`.
+     */
+    QSDLJoystickButtonEvent(SDL_Event event, SDL_EventType type);
+
+    /**
+     * @brief Provides direct access to the native `SDL_JoyButtonEvent` data.
+     * @return A constant reference to the underlying `SDL_JoyButtonEvent` structure with the button data such as `button` and `down`.
+     */
+    const SDL_JoyButtonEvent &sdlEvent() const;
+};
+} // namespace QtSDL
+#endif // QSDLJOYSTICKBUTTONEVENT_H
@@ -0,0 +1,44 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLJOYSTICKEVENT_H
+#define QSDLJOYSTICKEVENT_H
+
+#include "QtSDL/qsdlevent.h" // Base class for custom SDL events in Qt
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLJoystickEvent class encapsulates an SDL joystick device event.
+ *
+ * This class wraps the `SDL_JoyDeviceEvent` structure of the joystick connection, disconnection
+ * and update events (`SDL_EVENT_JOYSTICK_ADDED`, `SDL_EVENT_JOYSTICK_REMOVED`,
+ * `SDL_EVENT_JOYSTICK_UPDATE_COMPLETE`). `SDLEventManager` opens joysticks that are not
+ * gamepads, such as flight sticks and racing wheels, when they are added.
+ *
+ * Gamepads that are also supported as joysticks receive both an `SDL_JoyDeviceEvent`
+ * and an `SDL_GamepadDeviceEvent`.
+ */
+class QTSDL_EXPORT QSDLJoystickEvent: public QSDLEvent
+{
+public:
+    /**
+     * @brief Constructs a QSDLJoystickEvent object.
+     * @param event The raw `SDL_Event` structure containing the joystick data.
+     * @param type The specific `SDL_EventType`, one of the joystick device event types.
+     */
+    QSDLJoystickEvent(SDL_Event event, SDL_EventType type);
+
+    /**
+     * @brief Provides direct access to the native `SDL_JoyDeviceEvent` data.
+     * @return A constant reference to the underlying `SDL_JoyDeviceEvent` structure with the device data such as `which`.
+     */
+    const SDL_JoyDeviceEvent &sdlEvent() const;
+};
+} // namespace QtSDL
+#endif // QSDLJOYSTICKEVENT_H
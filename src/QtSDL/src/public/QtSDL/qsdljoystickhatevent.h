@@ -0,0 +1,39 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLJOYSTICKHATEVENT_H
+#define QSDLJOYSTICKHATEVENT_H
+
+#include "QtSDL/qsdlevent.h" // Base class for custom SDL events in Qt
+
+namespace QtSDL {
+
+/**
+ * @brief The QSDLJoystickHatEvent class encapsulates an SDL joystick hat event.
+ *
+ * This class wraps the `SDL_JoyHatEvent` structure (`SDL_EVENT_JOYSTICK_HAT_MOTION`).
+ * The value is a combination of the `SDL_HAT_*` flags.
+ */
+class QTSDL_EXPORT QSDLJoystickHatEvent: public QSDLEvent
+{
+public:
+    /**
+     * @brief Constructs a QSDLJoystickHatEvent object.
+     * @param event The raw `SDL_Event` structure containing the joystick data.
+     * @param type The specific `SDL_EventType`, `SDL_EVENT_JOYSTICK_HAT_MOTION`.
+     */
+    QSDLJoystickHatEvent(SDL_Event event, SDL_EventType type);
+
+    /**
+     * @brief Provides direct access to the native `SDL_JoyHatEvent` data.
+     * @return A constant reference to the underlying `SDL_JoyHatEvent` structure with the hat data such as `hat` and `value`.
+     */
+    const SDL_JoyHatEvent &sdlEvent() const;
+};
+} // namespace QtSDL
+#endif // QSDLJOYSTICKHATEVENT_H
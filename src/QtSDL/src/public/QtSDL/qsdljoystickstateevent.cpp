@@ -0,0 +1,46 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "qsdljoystickstateevent.h"
+#include "qsdlevent.h"
+
+namespace QtSDL {
+
+bool JoystickState::button(int button) const {
+    if (button < 0 || button >= MAX_BUTTONS) {
+        return false;
+    }
+
+    return (buttons[button / 64] >> (button % 64)) & 1;
+}
+
+void JoystickState::setButton(int button, bool down) {
+    if (button < 0 || button >= MAX_BUTTONS) {
+        return;
+    }
+
+    const quint64 bit = quint64(1) << (button % 64);
+    buttons[button / 64] = (down)? buttons[button / 64] | bit: buttons[button / 64] & ~bit;
+}
+
+QSDLJoystickStateEvent::QSDLJoystickStateEvent(const JoystickState &state):
+    QEvent(static_cast<QEvent::Type>(QSDLEvent::SDLJoystickStateType)),
+    _state(state) {
+}
+
+QEvent *QSDLJoystickStateEvent::clone() const {
+    return new QSDLJoystickStateEvent(_state);
+}
+
+const JoystickState &QSDLJoystickStateEvent::state() const {
+    return _state;
+}
+
+SDL_JoystickID QSDLJoystickStateEvent::device() const {
+    return _state.device;
+}
+}
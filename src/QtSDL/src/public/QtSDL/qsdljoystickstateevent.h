@@ -0,0 +1,107 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef QSDLJOYSTICKSTATEEVENT_H
+#define QSDLJOYSTICKSTATEEVENT_H
+
+#include <QEvent>
+#include <QVarLengthArray>
+#include <SDL3/SDL.h>
+#include <array>
+#include "deviceslot.h"
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The JoystickState struct is a compact state packet of one joystick.
+ *
+ * It holds the full button and hat state and only the axes that changed since the previous packet.
+ */
+struct QTSDL_EXPORT JoystickState {
+    /// The maximum number of buttons stored in the packet.
+    static constexpr int MAX_BUTTONS = 128;
+    /// The maximum number of hats stored in the packet.
+    static constexpr int MAX_HATS = 8;
+    /// The maximum number of axes tracked for changes.
+    static constexpr int MAX_AXES = 64;
+
+    /**
+     * @brief The Axis struct is the new value of a changed axis.
+     */
+    struct Axis {
+        /// The index of the axis.
+        Uint8 axis = 0;
+        /// The value of the axis, from `SDL_JOYSTICK_AXIS_MIN` to `SDL_JOYSTICK_AXIS_MAX`.
+        Sint16 value = 0;
+    };
+
+    /// The SDL joystick instance id of the joystick.
+    SDL_JoystickID device = 0;
+    /// The slot of the joystick.
+    DeviceSlot slot;
+    /// The SDL timestamp (in nanoseconds) of the `SDL_EVENT_JOYSTICK_UPDATE_COMPLETE` event that closed the packet.
+    Uint64 timestamp = 0;
+    /// The bitmask of pressed buttons, the bit N of the word N / 64 corresponds to the button N.
+    std::array<quint64, MAX_BUTTONS / 64> buttons {};
+    /// The values of the hats, combinations of the `SDL_HAT_*` flags.
+    std::array<Uint8, MAX_HATS> hats {};
+    /// The axes that changed since the previous packet, in the ascending order of their indexes.
+    QVarLengthArray<Axis, 16> changedAxes;
+
+    /**
+     * @brief Checks whether a button is pressed.
+     * @param button The index of the button.
+     */
+    bool button(int button) const;
+
+    /**
+     * @brief Sets the state of a button. Buttons above `MAX_BUTTONS` are ignored.
+     * @param button The index of the button.
+     * @param down true if the button is pressed.
+     */
+    void setButton(int button, bool down);
+};
+
+/**
+ * @brief The QSDLJoystickStateEvent class delivers a compact state packet of one joystick.
+ *
+ * When `SDLEventManager::setJoystickStateDelivery()` is enabled, the axis, button and hat events
+ * of the joysticks opened by the manager are folded into a `JoystickState` instead of being posted
+ * one by one. The state is posted once per `SDL_EVENT_JOYSTICK_UPDATE_COMPLETE` in which it changed.
+ */
+class QTSDL_EXPORT QSDLJoystickStateEvent: public QEvent
+{
+public:
+    /**
+     * @brief Constructs a state event.
+     * @param state The state packet.
+     */
+    explicit QSDLJoystickStateEvent(const JoystickState& state);
+
+    /**
+     * @brief Creates a deep copy of the event.
+     * @return A pointer to a newly allocated `QSDLJoystickStateEvent` object.
+     */
+    QEvent *clone() const override;
+
+    /**
+     * @brief Returns the state packet.
+     */
+    const JoystickState& state() const;
+
+    /**
+     * @brief Returns the SDL joystick instance id of the joystick.
+     */
+    SDL_JoystickID device() const;
+
+private:
+    JoystickState _state;
+};
+} // namespace QtSDL
+#endif // QSDLJOYSTICKSTATEEVENT_H
@@ -6,166 +6,2345 @@
 //#
 
 
+#include "QtSDL/qsdlactionevent.h"
 #include "QtSDL/qsdlgamepadaxisevent.h"
-#include "QtSDL/qsdlgamepadbuttonevent.h"
-#include "QtSDL/qsdlgamepadevent.h"
-#include "QtSDL/qsdlgamepadsensorevent.h"
-#include "QtSDL/qsdlgamepadtouchpadevent.h"
+#include "QtSDL/qsdleventbatch.h"
+#include "QtSDL/qsdleventfactory.h"
+#include "QtSDL/qsdlgamepadorientationevent.h"
+#include "QtSDL/qsdlgamepadsensorblockevent.h"
+#include "QtSDL/qsdlgamepadtouchpadtrajectoryevent.h"
+#include "QtSDL/qsdljoystickstateevent.h"
 #include "qsdlevent.h"
 #include "sdleventmanager.h"
 #include <QCoreApplication>
+#include <QDebug>
+#include <QMutexLocker>
+#include <QTimer>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
 
 namespace QtSDL {
 
-SDLEventManager::SDLEventManager(QObject* parent): QThread(parent) {}
+namespace {
+/**
+ * @brief The shortest timeout of the adaptive wait mode, used right after input activity.
+ */
+constexpr int ADAPTIVE_MIN_TIMEOUT = 1;
+
+/**
+ * @brief The number of events reserved for a new cycle to avoid reallocations on input bursts.
+ */
+constexpr qsizetype CYCLE_RESERVE = 64;
+
+/**
+ * @brief The maximum number of replayed events processed in one cycle when replaying as fast as possible.
+ */
+constexpr qsizetype REPLAY_CHUNK = 1024;
+
+/**
+ * @brief The CategoryRange struct maps an event category to the range of SDL event types it covers.
+ */
+struct CategoryRange {
+    SDLEventManager::EventCategory category;
+    Uint32 first;
+    Uint32 last;
+};
+
+/**
+ * @brief The SDL event type ranges of the event categories, following the layout of `SDL_EventType`.
+ */
+constexpr CategoryRange CATEGORY_RANGES[] = {
+    {SDLEventManager::ApplicationEvents, SDL_EVENT_QUIT, 0x14F},
+    {SDLEventManager::DisplayEvents, 0x150, 0x1FF},
+    {SDLEventManager::WindowEvents, 0x200, 0x2FF},
+    {SDLEventManager::KeyboardEvents, SDL_EVENT_KEY_DOWN, 0x3FF},
+    {SDLEventManager::MouseEvents, SDL_EVENT_MOUSE_MOTION, 0x4FF},
+    {SDLEventManager::JoystickEvents, SDL_EVENT_JOYSTICK_AXIS_MOTION, SDL_EVENT_GAMEPAD_AXIS_MOTION - 1},
+    {SDLEventManager::GamepadEvents, SDL_EVENT_GAMEPAD_AXIS_MOTION, 0x6FF},
+    {SDLEventManager::TouchEvents, SDL_EVENT_FINGER_DOWN, 0x7FF},
+    {SDLEventManager::ClipboardEvents, SDL_EVENT_CLIPBOARD_UPDATE, 0x9FF},
+    {SDLEventManager::DropEvents, SDL_EVENT_DROP_FILE, 0x10FF},
+    {SDLEventManager::AudioEvents, SDL_EVENT_AUDIO_DEVICE_ADDED, 0x11FF},
+    {SDLEventManager::SensorEvents, SDL_EVENT_SENSOR_UPDATE, 0x12FF},
+    {SDLEventManager::PenEvents, SDL_EVENT_PEN_PROXIMITY_IN, 0x13FF},
+    {SDLEventManager::CameraEvents, SDL_EVENT_CAMERA_DEVICE_ADDED, 0x14FF},
+    {SDLEventManager::RenderEvents, SDL_EVENT_RENDER_TARGETS_RESET, 0x20FF},
+};
+}
+
+SDLEventManager::SDLEventManager(QObject* parent):
+    SDLEventManager(ThreadingMode::Threaded, parent) {
+}
+
+SDLEventManager::SDLEventManager(ThreadingMode threadingMode, QObject *parent):
+    QThread(parent),
+    m_threadingMode(threadingMode) {
+    m_wakeEventType = SDL_RegisterEvents(1);
+    if (!m_wakeEventType) {
+        qWarning() << "SDLEventManager: failed to register the wake-up event:" << SDL_GetError();
+    }
+
+    if (m_threadingMode == ThreadingMode::Inline) {
+        m_inlineTimer = new QTimer(this);
+        m_inlineTimer->setSingleShot(true);
+        m_inlineTimer->setTimerType(Qt::PreciseTimer);
+        connect(m_inlineTimer, &QTimer::timeout, this, &SDLEventManager::pumpInline);
+    }
+}
 
 SDLEventManager::~SDLEventManager() {
     stop();
     wait();
+    stopInline();
 
     SDL_Quit();
 }
 
 
+void SDLEventManager::startInline() {
+    if (m_threadingMode == ThreadingMode::Threaded) {
+        qWarning() << "SDLEventManager: the threaded manager is started with start()";
+        return;
+    }
+
+    if (m_inlineActive) {
+        return;
+    }
+
+    m_quitFlag = false;
+    m_inlineActive = true;
+    m_inlineInterval = ADAPTIVE_MIN_TIMEOUT;
+    SDL_AddEventWatch(&SDLEventManager::inlineEventWatch, this);
+    m_inlineTimer->start(0);
+}
+
+void SDLEventManager::start(const QFuture<bool> &initialized, Priority priority) {
+    m_startPending = true;
+
+    QFuture<bool> future = initialized;
+    future.then(this, [this, priority](bool success) {
+        if (!m_startPending.exchange(false)) {
+            return;
+        }
+
+        if (!success) {
+            qWarning() << "SDLEventManager: SDL initialization failed, the manager is not started.";
+            return;
+        }
+
+        if (m_threadingMode == ThreadingMode::Inline) {
+            startInline();
+        } else {
+            QThread::start(priority);
+        }
+    });
+}
+
 void SDLEventManager::stop() {
     m_quitFlag = true;
+    m_startPending = false;
+
+    if (m_threadingMode == ThreadingMode::Inline && QThread::currentThread() == thread()) {
+        stopInline();
+        return;
+    }
+
+    wakeUp();
+}
+
+SDLEventManager::ThreadingMode SDLEventManager::threadingMode() const {
+    return m_threadingMode;
+}
+
+void SDLEventManager::wakeUp() {
+    if (m_threadingMode == ThreadingMode::Inline) {
+        scheduleInlinePump();
+        return;
+    }
+
+    if (!m_wakeEventType || !isRunning()) {
+        return;
+    }
+
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = m_wakeEventType;
+    event.common.timestamp = SDL_GetTicksNS();
+    SDL_PushEvent(&event);
+}
+
+bool SDLEventManager::waitEvent(SDL_Event *event, int timeout) {
+    const int pending = pendingTimeout();
+
+    switch (m_waitMode.load(std::memory_order_relaxed)) {
+    case WaitMode::Wait:
+        return SDL_WaitEventTimeout(event, pending);
+    case WaitMode::Adaptive:
+        return SDL_WaitEventTimeout(event, (pending >= 0)? std::min(pending, timeout): timeout);
+    case WaitMode::Poll:
+    default:
+        return SDL_PollEvent(event);
+    }
 }
 
 void QtSDL::SDLEventManager::run() {
+    // QThread::start() can still be reached through a QThread pointer or a signal connection.
+    // The inline pump must run in the thread the manager lives in, so the start is handed over there.
+    if (m_threadingMode == ThreadingMode::Inline) {
+        QMetaObject::invokeMethod(this, &SDLEventManager::startInline, Qt::QueuedConnection);
+        return;
+    }
+
     m_quitFlag = false;
 
     auto appInstance = QCoreApplication::instance();
+    int adaptiveTimeout = ADAPTIVE_MIN_TIMEOUT;
     while (!m_quitFlag && appInstance) {
-        SDL_Event event;
-        while (SDL_PollEvent(&event)) {
-
-            // SDL_EVENT_GAMEPAD_AXIS_MOTION  = 0x650, /**< Gamepad axis motion */
-            //     SDL_EVENT_GAMEPAD_BUTTON_DOWN,          /**< Gamepad button pressed */
-            //     SDL_EVENT_GAMEPAD_BUTTON_UP,            /**< Gamepad button released */
-            //     SDL_EVENT_GAMEPAD_ADDED,                /**< A new gamepad has been inserted into the system */
-            //     SDL_EVENT_GAMEPAD_REMOVED,              /**< A gamepad has been removed */
-            //     SDL_EVENT_GAMEPAD_REMAPPED,             /**< The gamepad mapping was updated */
-            //     SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN,        /**< Gamepad touchpad was touched */
-            //     SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION,      /**< Gamepad touchpad finger was moved */
-            //     SDL_EVENT_GAMEPAD_TOUCHPAD_UP,          /**< Gamepad touchpad finger was lifted */
-            //     SDL_EVENT_GAMEPAD_SENSOR_UPDATE,        /**< Gamepad sensor was updated */
-            //     SDL_EVENT_GAMEPAD_UPDATE_COMPLETE,      /**< Gamepad update is complete */
-            //     SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED,  /**< Gamepad Steam handle has changed */
-
-
-            switch (event.type) {
-            case SDL_EVENT_GAMEPAD_ADDED: {
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(!m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
-
-                m_gamepads[device_index] = SDL_OpenGamepad(device_index);
-
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadEvent(event,
-                                                            static_cast<SDL_EventType>(event.type)));
-                break;
+        const bool active = processCycle(appInstance, adaptiveTimeout);
+
+        switch (m_waitMode.load(std::memory_order_relaxed)) {
+        case WaitMode::Poll:
+            // A replay running as fast as possible is not throttled by the polling delay.
+            if (m_eventDelay && !(m_replay && m_replaySpeed <= 0)) {
+                SDL_Delay(m_eventDelay);
             }
+            break;
+        case WaitMode::Adaptive:
+            adaptiveTimeout = (active)? ADAPTIVE_MIN_TIMEOUT:
+                                  std::min(adaptiveTimeout * 2, std::max(m_eventDelay, ADAPTIVE_MIN_TIMEOUT));
+            break;
+        case WaitMode::Wait:
+            break;
+        }
+    }
 
-            case SDL_EVENT_GAMEPAD_REMOVED: {
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
+}
 
-                SDL_CloseGamepad(m_gamepads.take(device_index));
+void SDLEventManager::publishDevices() {
+    QList<std::shared_ptr<const DeviceInfo>> infos(m_devices.slotCount());
+    for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+        infos[entry.slot.index] = entry.info;
+    }
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadEvent(event,
-                                                            static_cast<SDL_EventType>(event.type)));
-                break;
-            }
+    QMutexLocker locker(&m_devicesMutex);
+    m_deviceInfos = std::move(infos);
+}
 
-            case SDL_EVENT_GAMEPAD_REMAPPED:
-            case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:
-            case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED: {
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
+void SDLEventManager::releaseDevices() {
+    if (m_devices.releaseRetired()) {
+        publishDevices();
+    }
+}
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadEvent(event,
-                                                     static_cast<SDL_EventType>(event.type)));
-                break;
-            }
+bool SDLEventManager::queueOutput(const OutputCommand &command) {
+    {
+        QMutexLocker locker(&m_outputMutex);
+        if (!m_output.push(command)) {
+            return false;
+        }
+    }
+
+    if (!m_outputWakePending.exchange(true)) {
+        wakeUp();
+    }
 
-            case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
-            case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
-            case SDL_EVENT_GAMEPAD_TOUCHPAD_UP: {
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
+    return true;
+}
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadTouchpadEvent(event,
-                                                            static_cast<SDL_EventType>(event.type)));
-                break;
+void SDLEventManager::executeOutput() {
+    m_outputWakePending = false;
+    m_output.drain([this](const OutputCommand& command) {
+        m_pendingOutput.insert((quint64(command.device) << 8) | command.effect, command);
+    });
 
-            }
+    if (m_pendingOutput.isEmpty()) {
+        return;
+    }
 
-            case SDL_EVENT_GAMEPAD_SENSOR_UPDATE: {
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
+    for (const OutputCommand& command : std::as_const(m_pendingOutput)) {
+        // Replayed gamepads have no handle.
+        SDL_Gamepad* gamepad = m_devices.gamepad(command.device);
+        SDL_Joystick* joystick = (gamepad)? nullptr: m_devices.joystick(command.device);
+        if (!gamepad && !joystick) {
+            continue;
+        }
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadSensorEvent(event,
-                                                                    static_cast<SDL_EventType>(event.type)));
-                break;
+        bool done = false;
+        switch (command.effect) {
+        case OutputCommand::Rumble:
+            done = (gamepad)? SDL_RumbleGamepad(gamepad, command.first, command.second, command.duration):
+                              SDL_RumbleJoystick(joystick, command.first, command.second, command.duration);
+            break;
+        case OutputCommand::TriggerRumble:
+            done = (gamepad)? SDL_RumbleGamepadTriggers(gamepad, command.first, command.second, command.duration):
+                              SDL_RumbleJoystickTriggers(joystick, command.first, command.second, command.duration);
+            break;
+        case OutputCommand::LED:
+            done = (gamepad)? SDL_SetGamepadLED(gamepad, command.first >> 8, command.first & 0xFF, command.second):
+                              SDL_SetJoystickLED(joystick, command.first >> 8, command.first & 0xFF, command.second);
+            break;
+        }
+
+        if (!done) {
+            qDebug() << "SDLEventManager: output command failed for the device" << command.device << ":" << SDL_GetError();
+        }
+    }
+
+    m_pendingOutput.clear();
+}
+
+bool SDLEventManager::processCycle(QCoreApplication *appInstance, int timeout) {
+    syncStateCache();
+    syncEventFilters();
+    syncJoystickStates();
+    syncActionMaps();
+    syncTouchpadTracking();
+    syncOrientationFusion();
+    syncReplay();
 
+    // The inline pump must never block the event loop of its thread.
+    SDL_Event event;
+    bool hasEvent = (m_threadingMode == ThreadingMode::Inline)? SDL_PollEvent(&event): waitEvent(&event, timeout);
+    bool active = false;
+
+    while (hasEvent) {
+        if (event.type != m_wakeEventType) {
+            if (m_recording.load(std::memory_order_relaxed) && InputRecorder::isRecordable(event.type)) {
+                m_recordBuffer.append(event);
             }
 
-            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
-            case SDL_EVENT_GAMEPAD_BUTTON_UP: {
+            processEvent(event);
+            active = true;
+        }
+
+        hasEvent = SDL_PollEvent(&event);
+    }
 
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
+    recordCycle();
+    if (m_replay && replayEvents()) {
+        active = true;
+    }
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadButtonEvent(event,
-                                                                  static_cast<SDL_EventType>(event.type)));
-                break;
+    if (m_stateCacheActive) {
+        m_stateCache.publish();
+    }
+
+    deliverCycle(appInstance);
+    deliverSensorBlocks(appInstance);
+    deliverJoystickStates(appInstance);
+    deliverActions(appInstance);
+    deliverTouchpadTrajectories(appInstance);
+    deliverOrientations(appInstance);
+    releaseBindings();
+    releaseDevices();
+    syncSensors();
+    reportMetrics();
+    executeOutput();
+
+    flushSentEvents();
+    return active;
+}
+
+void SDLEventManager::pumpInline() {
+    m_inlineWakePending = false;
+
+    auto appInstance = QCoreApplication::instance();
+    if (m_quitFlag || !appInstance) {
+        stopInline();
+        return;
+    }
+
+    const bool active = processCycle(appInstance, 0);
+
+    m_inlineInterval = (active)? ADAPTIVE_MIN_TIMEOUT:
+                           std::min(m_inlineInterval * 2, std::max(m_eventDelay, ADAPTIVE_MIN_TIMEOUT));
+
+    const int pending = pendingTimeout();
+    m_inlineTimer->start((pending >= 0)? std::min(pending, m_inlineInterval): m_inlineInterval);
+}
+
+void SDLEventManager::scheduleInlinePump() {
+    if (m_inlineWakePending.exchange(true)) {
+        return;
+    }
+
+    QMetaObject::invokeMethod(this, [this]() {
+        if (m_inlineActive) {
+            m_inlineInterval = ADAPTIVE_MIN_TIMEOUT;
+            m_inlineTimer->start(0);
+        } else {
+            m_inlineWakePending = false;
+        }
+    }, Qt::QueuedConnection);
+}
+
+void SDLEventManager::stopInline() {
+    if (!m_inlineActive) {
+        return;
+    }
+
+    m_inlineActive = false;
+    m_inlineTimer->stop();
+    SDL_RemoveEventWatch(&SDLEventManager::inlineEventWatch, this);
+}
+
+bool SDLEventManager::inlineEventWatch(void *userdata, SDL_Event *) {
+    // Events pumped by the manager itself are drained in the current cycle.
+    auto manager = static_cast<SDLEventManager*>(userdata);
+    if (QThread::currentThread() != manager->thread()) {
+        manager->scheduleInlinePump();
+    }
+
+    return true;
+}
+
+void SDLEventManager::dispatchEvent(QObject *receiver, QEvent *event) {
+    if (m_threadingMode == ThreadingMode::Inline && receiver->thread() == QThread::currentThread()) {
+        m_sentEvents.append({receiver, event});
+        return;
+    }
+
+    QCoreApplication::postEvent(receiver, event);
+}
+
+void SDLEventManager::flushSentEvents() {
+    if (m_sentEvents.isEmpty()) {
+        return;
+    }
+
+    // A receiver may trigger another cycle, for example with a nested event loop.
+    const QList<SentEvent> events = std::move(m_sentEvents);
+    m_sentEvents.clear();
+
+    for (const SentEvent& sent : events) {
+        if (sent.receiver) {
+            QCoreApplication::sendEvent(sent.receiver, sent.event);
+        }
+        delete sent.event;
+    }
+}
+
+void SDLEventManager::processEvent(const SDL_Event &event) {
+
+    // SDL_EVENT_GAMEPAD_AXIS_MOTION  = 0x650, /**< Gamepad axis motion */
+    //     SDL_EVENT_GAMEPAD_BUTTON_DOWN,          /**< Gamepad button pressed */
+    //     SDL_EVENT_GAMEPAD_BUTTON_UP,            /**< Gamepad button released */
+    //     SDL_EVENT_GAMEPAD_ADDED,                /**< A new gamepad has been inserted into the system */
+    //     SDL_EVENT_GAMEPAD_REMOVED,              /**< A gamepad has been removed */
+    //     SDL_EVENT_GAMEPAD_REMAPPED,             /**< The gamepad mapping was updated */
+    //     SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN,        /**< Gamepad touchpad was touched */
+    //     SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION,      /**< Gamepad touchpad finger was moved */
+    //     SDL_EVENT_GAMEPAD_TOUCHPAD_UP,          /**< Gamepad touchpad finger was lifted */
+    //     SDL_EVENT_GAMEPAD_SENSOR_UPDATE,        /**< Gamepad sensor was updated */
+    //     SDL_EVENT_GAMEPAD_UPDATE_COMPLETE,      /**< Gamepad update is complete */
+    //     SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED,  /**< Gamepad Steam handle has changed */
+
+    if (dropIgnoredDeviceEvent(event)) {
+        return;
+    }
+
+    if (event.type == SDL_EVENT_GAMEPAD_SENSOR_UPDATE && m_sensorDecimation) {
+        SDL_Event sample = event;
+        if (decimateSensorEvent(sample)) {
+            appendEvent(sample);
+        }
+        return;
+    }
+
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_ADDED: {
+        int device_index = event.gdevice.which;
+        if (!m_processingReplay && !m_activeAllowlist.acceptsGamepad(device_index)) {
+            m_ignoredDevices.insert(device_index);
+            return;
+        }
+
+        // A joystick that acquired a gamepad mapping is opened again as a gamepad.
+        if (m_devices.joystick(device_index)) {
+            closeJoystick(device_index);
+        }
+
+        Q_ASSERT_X(!m_devices.contains(device_index), __FUNCTION__, "receivet invalid device index");
 
+        // Replayed gamepads are registered without opening a real device.
+        SDL_Gamepad* gamepad = (m_processingReplay)? nullptr: SDL_OpenGamepad(device_index);
+        // The ids of replayed gamepads belong to the recording session, so SDL knows nothing about them now.
+        const auto recorded = (m_processingReplay)? m_replayDeviceInfo.constFind(device_index): m_replayDeviceInfo.constEnd();
+        m_devices.insert(device_index, gamepad, (recorded != m_replayDeviceInfo.constEnd())?
+                                                    recorded.value(): DeviceInfo::capture(device_index, gamepad));
+        publishDevices();
+        m_sensorsDirty = true;
+        if (!m_bindingList.isEmpty()) {
+            if (QObject* target = resolveBinding(device_index)) {
+                m_boundDevices.insert(device_index, target);
             }
+        }
+        if (m_stateCacheActive) {
+            m_stateCache.addDevice(device_index, gamepad);
+        }
+        break;
+    }
 
-            case SDL_EVENT_GAMEPAD_AXIS_MOTION: {
+    case SDL_EVENT_GAMEPAD_REMOVED: {
+        int device_index = event.gdevice.which;
+        Q_ASSERT_X(m_devices.contains(device_index), __FUNCTION__, "receivet invalid device index");
 
-                int device_index = event.gdevice.which;
-                Q_ASSERT_X(m_gamepads.contains(device_index), __FUNCTION__, "receivet invalid device index");
+        // The last samples of the gamepad are posted before its removal, and its buffers are dropped.
+        flushSensorBlocks(device_index);
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLGamepadAxisEvent(event,
-                                                                  static_cast<SDL_EventType>(event.type)));
-                break;
+        SDL_CloseGamepad(m_devices.remove(device_index).gamepad);
+        if (m_boundDevices.contains(device_index)) {
+            m_releasedBindings.append(device_index);
+        }
+        m_axisFilter.removeDevice(device_index);
+        m_sensorsDirty = true;
+        if (m_stateCacheActive) {
+            m_stateCache.removeDevice(device_index);
+        }
+        if (m_touchpadTrackingActive) {
+            m_touchpadTracker.removeDevice(device_index, event.gdevice.timestamp);
+        }
+        if (m_orientationFusionActive) {
+            m_orientationFilter.removeDevice(device_index);
+        }
+        break;
+    }
+
+    case SDL_EVENT_JOYSTICK_ADDED: {
+        // Gamepads are opened on SDL_EVENT_GAMEPAD_ADDED, replayed joysticks are not supported.
+        const SDL_JoystickID device = event.jdevice.which;
+        if (m_processingReplay || !m_activeCategories.testFlag(JoystickEvents) ||
+            m_devices.contains(device) || SDL_IsGamepad(device)) {
+            break;
+        }
+
+        if (!m_activeAllowlist.acceptsJoystick(device)) {
+            m_ignoredJoysticks.insert(device);
+            return;
+        }
+
+        SDL_Joystick* joystick = SDL_OpenJoystick(device);
+        if (!joystick) {
+            qWarning() << "SDLEventManager: failed to open the joystick" << device << ":" << SDL_GetError();
+            break;
+        }
+
+        m_devices.insertJoystick(device, joystick, DeviceInfo::captureJoystick(device, joystick));
+        publishDevices();
+        if (m_joystickStatesActive) {
+            m_joystickStates.insert(device, {});
+        }
+        break;
+    }
+
+    case SDL_EVENT_JOYSTICK_REMOVED:
+        if (m_devices.joystick(event.jdevice.which)) {
+            closeJoystick(event.jdevice.which);
+        }
+        break;
+
+    default:
+        Q_ASSERT_X(QSDLEventFactory::descriptor(event.type).validation != QSDLEventFactory::RequiresOpenedDevice ||
+                       m_devices.contains(event.gdevice.which),
+                   __FUNCTION__, "receivet invalid device index");
+        break;
+    }
+
+    appendEvent(event);
+}
+
+void SDLEventManager::appendEvent(const SDL_Event &event) {
+    if (m_stateCacheActive) {
+        m_stateCache.update(event);
+    }
+
+    if (m_touchpadTrackingActive && m_touchpadTracker.process(event)) {
+        return;
+    }
+
+    if (event.type == SDL_EVENT_GAMEPAD_SENSOR_UPDATE && m_orientationFusionActive &&
+        m_orientationFilter.push(event.gsensor)) {
+        return;
+    }
+
+    if (event.type == SDL_EVENT_GAMEPAD_SENSOR_UPDATE && m_sensorBlockDelivery.load(std::memory_order_relaxed)) {
+        bufferSensorEvent(event.gsensor);
+        return;
+    }
 
+    if (event.type == SDL_EVENT_GAMEPAD_AXIS_MOTION && m_axisCoalescing.load(std::memory_order_relaxed)) {
+        coalesceAxisEvent(event);
+        return;
+    }
+
+    if (!m_joystickStates.isEmpty() && event.type >= SDL_EVENT_JOYSTICK_AXIS_MOTION &&
+        event.type <= SDL_EVENT_JOYSTICK_UPDATE_COMPLETE && foldJoystickEvent(event)) {
+        return;
+    }
+
+    m_cycle.append(event);
+}
+
+void SDLEventManager::coalesceAxisEvent(const SDL_Event &event) {
+    const quint64 key = axisKey(event.gaxis);
+    auto it = m_axisMerges.find(key);
+    if (it == m_axisMerges.end()) {
+        m_axisMerges.insert(key, {m_cycle.size(), 1, event.gaxis.timestamp});
+        m_cycle.append(event);
+        return;
+    }
+
+    // The previous sample is superseded. It is marked as dead and removed in deliverCycle,
+    // the latest value takes the position of the last sample to keep the order with other events.
+    m_cycle[it->index].type = SDL_EVENT_FIRST;
+    it->index = m_cycle.size();
+    ++it->samples;
+    m_hasDeadEvents = true;
+    m_cycle.append(event);
+}
+
+bool SDLEventManager::decimateSensorEvent(SDL_Event &event) {
+    const SDL_GamepadSensorEvent& sample = event.gsensor;
+    const quint64 key = (static_cast<quint64>(sample.which) << 32) | static_cast<quint32>(sample.sensor);
+    auto it = m_sensorDecimators.find(key);
+    if (it == m_sensorDecimators.end() || !it->period) {
+        return true;
+    }
+
+    // The first sample is delivered at once and starts the periods.
+    const Uint64 time = (sample.sensor_timestamp)? sample.sensor_timestamp: sample.timestamp;
+    if (!it->deadline) {
+        it->deadline = time + it->period;
+        return true;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        it->sum[i] += sample.data[i];
+    }
+    ++it->samples;
+
+    if (time < it->deadline) {
+        return false;
+    }
+
+    // The periods follow a fixed grid, so the jitter of the samples does not lower the rate.
+    it->deadline = (time - it->deadline < it->period)? it->deadline + it->period: time + it->period;
+    for (int i = 0; i < 3; ++i) {
+        event.gsensor.data[i] = static_cast<float>(it->sum[i] / it->samples);
+    }
+
+    it->sum = {};
+    it->samples = 0;
+    return true;
+}
+
+void SDLEventManager::syncSensors() {
+    if (m_sensorRequestsDirty.load(std::memory_order_acquire)) {
+        QMutexLocker locker(&m_sensorMutex);
+        m_sensorRequestsDirty.store(false, std::memory_order_relaxed);
+        m_sensorRequestList = m_sensorRequests;
+        m_sensorsDirty = true;
+    }
+
+    if (!m_sensorsDirty) {
+        return;
+    }
+    m_sensorsDirty = false;
+
+    QHash<quint64, SensorDecimator> enabled;
+    for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+        // Replayed gamepads and joysticks have no gamepad sensors to enable.
+        if (!entry.gamepad) {
+            continue;
+        }
+
+        for (const SensorRequest& request : std::as_const(m_sensorRequestList)) {
+            if (!entry.info->hasSensor(request.sensor) || !request.devices.matches(entry.id)) {
+                continue;
             }
 
+            const quint64 key = (static_cast<quint64>(entry.id) << 32) | static_cast<quint32>(request.sensor);
+            auto it = enabled.find(key);
+            if (it == enabled.end()) {
+                enabled.insert(key, {request.rate});
+            } else if (it->rate > 0) {
+                it->rate = (request.rate > 0)? std::max(it->rate, request.rate): 0;
+            }
+        }
+    }
+
+    for (auto it = m_sensorDecimators.cbegin(); it != m_sensorDecimators.cend(); ++it) {
+        if (enabled.contains(it.key())) {
+            continue;
+        }
 
+        // The sensors of disconnected gamepads were closed with them.
+        if (SDL_Gamepad* gamepad = m_devices.gamepad(static_cast<SDL_JoystickID>(it.key() >> 32))) {
+            SDL_SetGamepadSensorEnabled(gamepad, static_cast<SDL_SensorType>(static_cast<qint32>(it.key() & 0xFFFFFFFF)), false);
+        }
+    }
 
-            default: {
+    m_sensorDecimation = false;
+    for (auto it = enabled.begin(); it != enabled.end();) {
+        const auto device = static_cast<SDL_JoystickID>(it.key() >> 32);
+        const auto sensor = static_cast<SDL_SensorType>(static_cast<qint32>(it.key() & 0xFFFFFFFF));
+        SDL_Gamepad* gamepad = m_devices.gamepad(device);
 
-                appInstance->postEvent(appInstance,
-                                       new QSDLEvent(event,
-                                                     static_cast<SDL_EventType>(event.type)));
-                break;
+        const auto previous = m_sensorDecimators.constFind(it.key());
+        if (previous == m_sensorDecimators.cend() && !SDL_SetGamepadSensorEnabled(gamepad, sensor, true)) {
+            qWarning() << "SDLEventManager: failed to enable the sensor" << sensor << "of the gamepad" << device << ":" << SDL_GetError();
+            it = enabled.erase(it);
+            continue;
+        }
+
+        const float native = SDL_GetGamepadSensorDataRate(gamepad, sensor);
+        if (it->rate > 0 && (native <= 0 || it->rate < native)) {
+            it->period = static_cast<Uint64>(SDL_NS_PER_SECOND / it->rate);
+        }
+
+        // An unchanged period keeps averaging the samples collected so far.
+        if (previous != m_sensorDecimators.cend() && previous->period == it->period) {
+            const float rate = it->rate;
+            *it = *previous;
+            it->rate = rate;
+        }
+
+        m_sensorDecimation = m_sensorDecimation || it->period;
+        ++it;
+    }
+
+    m_sensorDecimators = std::move(enabled);
+}
+
+void SDLEventManager::syncStateCache() {
+    const bool enabled = m_stateCacheEnabled.load(std::memory_order_relaxed);
+    if (enabled == m_stateCacheActive) {
+        return;
+    }
+
+    m_stateCacheActive = enabled;
+    if (!enabled) {
+        m_stateCache.clear();
+        return;
+    }
+
+    for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+        m_stateCache.addDevice(entry.id, entry.gamepad);
+    }
+}
+
+void SDLEventManager::syncEventFilters() {
+    // User event types reserved after the category was disabled are disabled too.
+    if (!m_activeCategories.testFlag(UserEvents) &&
+        QSDLEventFactory::registeredEventsRevision() != m_userEventsRevision) {
+        setUserEventsEnabled(false);
+    }
+
+    if (!m_filtersDirty.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    EventCategories categories;
+    bool axisFilter;
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_filtersDirty.store(false, std::memory_order_relaxed);
+        categories = m_eventCategories;
+        m_activeAllowlist = m_deviceAllowlist;
+
+        axisFilter = m_axisFilterEnabled;
+        m_axisFilter.setDefaultSettings(m_axisFilterSettings);
+        m_axisFilter.setDeviceSettings(m_deviceAxisFilterSettings);
+    }
+
+    if (axisFilter != m_axisFilterActive) {
+        m_axisFilterActive = axisFilter;
+        m_axisFilter.clear();
+    }
+
+    if (categories != m_activeCategories) {
+        setCategoriesEnabled(m_activeCategories & ~categories, false);
+        setCategoriesEnabled(categories & ~m_activeCategories, true);
+
+        // SDL detects gamepads through the joystick connection events.
+        const bool hotplug = categories.testFlag(JoystickEvents) || categories.testFlag(GamepadEvents);
+        SDL_SetEventEnabled(SDL_EVENT_JOYSTICK_ADDED, hotplug);
+        SDL_SetEventEnabled(SDL_EVENT_JOYSTICK_REMOVED, hotplug);
+
+        m_activeCategories = categories;
+    }
 
+    // Opened devices rejected by the new allowlist are closed as if they were disconnected.
+    const QList<DeviceSlotMap::Entry> opened = m_devices.entries();
+    for (const DeviceSlotMap::Entry& entry : opened) {
+        if (entry.joystick) {
+            if (!m_activeAllowlist.acceptsJoystick(entry.id)) {
+                processEvent(gamepadDeviceEvent(SDL_EVENT_JOYSTICK_REMOVED, entry.id));
+                m_ignoredJoysticks.insert(entry.id);
             }
+        } else if (!m_activeAllowlist.acceptsGamepad(entry.id)) {
+            processEvent(gamepadDeviceEvent(SDL_EVENT_GAMEPAD_REMOVED, entry.id));
+            m_ignoredDevices.insert(entry.id);
+        }
+    }
+
+    const QList<SDL_JoystickID> ignored = m_ignoredDevices.values();
+    for (SDL_JoystickID device : ignored) {
+        if (m_activeAllowlist.acceptsGamepad(device)) {
+            m_ignoredDevices.remove(device);
+            processEvent(gamepadDeviceEvent(SDL_EVENT_GAMEPAD_ADDED, device));
+        }
+    }
+
+    const QList<SDL_JoystickID> ignoredJoysticks = m_ignoredJoysticks.values();
+    for (SDL_JoystickID device : ignoredJoysticks) {
+        if (m_activeAllowlist.acceptsJoystick(device)) {
+            m_ignoredJoysticks.remove(device);
+            processEvent(gamepadDeviceEvent(SDL_EVENT_JOYSTICK_ADDED, device));
+        }
+    }
+}
+
+void SDLEventManager::setCategoriesEnabled(EventCategories categories, bool enabled) {
+    if (!categories) {
+        return;
+    }
+
+    for (const CategoryRange& range : CATEGORY_RANGES) {
+        if (!categories.testFlag(range.category)) {
+            continue;
+        }
+
+        for (Uint32 type = range.first; type <= range.last; ++type) {
+            if (type == m_wakeEventType || type == SDL_EVENT_JOYSTICK_ADDED || type == SDL_EVENT_JOYSTICK_REMOVED) {
+                continue;
             }
 
+            SDL_SetEventEnabled(type, enabled);
+        }
+    }
+
+    if (categories.testFlag(UserEvents)) {
+        setUserEventsEnabled(enabled);
+    }
+}
 
+void SDLEventManager::setUserEventsEnabled(bool enabled) {
+    // Only the reserved types are toggled instead of the whole user range of about 32k types.
+    m_userEventsRevision = QSDLEventFactory::registeredEventsRevision();
+    const QList<QSDLEventFactory::TypeRange> ranges = QSDLEventFactory::registeredEvents();
+    for (const QSDLEventFactory::TypeRange& range : ranges) {
+        for (Uint32 type = range.first; type - range.first < range.count; ++type) {
+            if (type != m_wakeEventType) {
+                SDL_SetEventEnabled(type, enabled);
+            }
         }
+    }
+}
+
+bool SDLEventManager::dropIgnoredDeviceEvent(const SDL_Event &event) {
+    if ((m_ignoredDevices.isEmpty() && m_ignoredJoysticks.isEmpty()) || !QSDLEventBatch::isDeviceEvent(event)) {
+        return false;
+    }
 
-        if (m_eventDelay) {
-            SDL_Delay(m_eventDelay);
+    if (m_ignoredJoysticks.contains(event.jdevice.which)) {
+        if (event.type == SDL_EVENT_JOYSTICK_REMOVED) {
+            m_ignoredJoysticks.remove(event.jdevice.which);
         }
+        return true;
+    }
+
+    if (!m_ignoredDevices.contains(event.jdevice.which)) {
+        return false;
+    }
+
+    if (event.type == SDL_EVENT_GAMEPAD_REMOVED) {
+        m_ignoredDevices.remove(event.jdevice.which);
     }
 
+    return true;
 }
 
-int SDLEventManager::eventDelay() const {
-    return m_eventDelay;
+SDL_Event SDLEventManager::gamepadDeviceEvent(Uint32 type, SDL_JoystickID device) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = type;
+    event.gdevice.timestamp = SDL_GetTicksNS();
+    event.gdevice.which = device;
+    return event;
 }
 
-void SDLEventManager::setEventDelay(int newEventDelay) {
+void SDLEventManager::closeJoystick(SDL_JoystickID device) {
+    SDL_CloseJoystick(m_devices.remove(device).joystick);
+    m_joystickStates.remove(device);
+    if (m_boundDevices.contains(device)) {
+        m_releasedBindings.append(device);
+    }
+}
+
+bool SDLEventManager::foldJoystickEvent(const SDL_Event &event) {
+    auto it = m_joystickStates.find(event.jdevice.which);
+    if (it == m_joystickStates.end()) {
+        return false;
+    }
+
+    JoystickAccumulator& accumulator = it.value();
+    switch (event.type) {
+    case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        if (event.jaxis.axis >= JoystickState::MAX_AXES) {
+            return false;
+        }
+        accumulator.axes[event.jaxis.axis] = event.jaxis.value;
+        accumulator.changedAxes |= quint64(1) << event.jaxis.axis;
+        break;
+    case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
+    case SDL_EVENT_JOYSTICK_BUTTON_UP:
+        if (event.jbutton.button >= JoystickState::MAX_BUTTONS) {
+            return false;
+        }
+        accumulator.state.setButton(event.jbutton.button, event.jbutton.down);
+        break;
+    case SDL_EVENT_JOYSTICK_HAT_MOTION:
+        if (event.jhat.hat >= JoystickState::MAX_HATS) {
+            return false;
+        }
+        accumulator.state.hats[event.jhat.hat] = event.jhat.value;
+        break;
+    case SDL_EVENT_JOYSTICK_UPDATE_COMPLETE:
+        if (accumulator.dirty) {
+            closeJoystickState(event.jdevice.which, accumulator, event.jdevice.timestamp);
+        }
+        return true;
+    default:
+        return false;
+    }
+
+    accumulator.dirty = true;
+    return true;
+}
+
+void SDLEventManager::closeJoystickState(SDL_JoystickID device, JoystickAccumulator &accumulator, Uint64 timestamp) {
+    JoystickState state = accumulator.state;
+    state.device = device;
+    state.slot = m_devices.slot(device);
+    state.timestamp = timestamp;
+
+    for (quint64 changed = accumulator.changedAxes; changed; changed &= changed - 1) {
+        const int axis = std::countr_zero(changed);
+        state.changedAxes.append({static_cast<Uint8>(axis), accumulator.axes[axis]});
+    }
+
+    m_joystickPackets.append(std::move(state));
+    accumulator.changedAxes = 0;
+    accumulator.dirty = false;
+}
+
+void SDLEventManager::deliverJoystickStates(QCoreApplication *appInstance) {
+    if (m_joystickPackets.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    for (const QtSDL::JoystickState& state : std::as_const(m_joystickPackets)) {
+        route(appInstance, JoystickStatePacket, state.device, [&state]() {
+            return new QSDLJoystickStateEvent(state);
+        });
+    }
+
+    m_joystickPackets.clear();
+}
+
+void SDLEventManager::syncJoystickStates() {
+    const bool enabled = m_joystickStateDelivery.load(std::memory_order_relaxed);
+    if (enabled == m_joystickStatesActive) {
+        return;
+    }
+
+    m_joystickStatesActive = enabled;
+    m_joystickStates.clear();
+    if (!enabled) {
+        return;
+    }
+
+    for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+        if (entry.joystick) {
+            m_joystickStates.insert(entry.id, {});
+        }
+    }
+}
+
+void SDLEventManager::syncActionMaps() {
+    if (!m_actionMapsDirty.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    bool enabled;
+    GamepadActionMap map;
+    QHash<SDL_JoystickID, GamepadActionMap> deviceMaps;
+    {
+        QMutexLocker locker(&m_actionsMutex);
+        m_actionMapsDirty.store(false, std::memory_order_relaxed);
+        enabled = m_actionMappingEnabled;
+        map = m_actionMap;
+        deviceMaps = m_deviceActionMaps;
+    }
+
+    const Uint64 now = SDL_GetTicksNS();
+    if (!enabled) {
+        if (m_actionMappingActive) {
+            for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+                m_actionMapper.removeDevice(entry.id, now, m_actionTransitions);
+            }
+            m_actionMapper.clear();
+            m_actionMappingActive = false;
+        }
+        return;
+    }
+
+    // The maps are replaced without stopping the manager, the actions of the opened gamepads are re-evaluated.
+    m_actionMapper.setMaps(map, deviceMaps, now, m_actionTransitions);
+    if (m_actionMappingActive) {
+        return;
+    }
+
+    m_actionMappingActive = true;
+    for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+        if (!entry.joystick) {
+            m_actionMapper.addDevice(entry.id, entry.gamepad, now, m_actionTransitions);
+        }
+    }
+}
+
+void SDLEventManager::mapActions() {
+    for (SDL_Event& event : m_cycle) {
+        switch (event.type) {
+        case SDL_EVENT_GAMEPAD_ADDED:
+            m_actionMapper.addDevice(event.gdevice.which, m_devices.gamepad(event.gdevice.which),
+                                     event.gdevice.timestamp, m_actionTransitions);
+            break;
+
+        case SDL_EVENT_GAMEPAD_REMOVED:
+            m_actionMapper.removeDevice(event.gdevice.which, event.gdevice.timestamp, m_actionTransitions);
+            break;
+
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+        case SDL_EVENT_GAMEPAD_BUTTON_UP:
+            // Consumed events are removed with the other dead events of the cycle.
+            if (m_actionMapper.process(event, m_actionTransitions)) {
+                event.type = SDL_EVENT_FIRST;
+                m_hasDeadEvents = true;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+void SDLEventManager::deliverActions(QCoreApplication *appInstance) {
+    if (m_actionTransitions.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    for (const GamepadActionMapper::Transition& transition : std::as_const(m_actionTransitions)) {
+        const DeviceSlot slot = m_devices.slot(transition.device);
+        route(appInstance, GamepadAction, transition.device, [&transition, slot]() {
+            return new QSDLActionEvent(transition, slot);
+        });
+    }
+
+    m_actionTransitions.clear();
+}
+
+void SDLEventManager::syncTouchpadTracking() {
+    const bool enabled = m_touchpadTracking.load(std::memory_order_relaxed);
+    if (enabled == m_touchpadTrackingActive) {
+        return;
+    }
+
+    m_touchpadTrackingActive = enabled;
+    m_touchpadTracker.clear();
+}
+
+void SDLEventManager::deliverTouchpadTrajectories(QCoreApplication *appInstance) {
+    if (!m_touchpadTracker.hasPending()) {
+        return;
+    }
+
+    // A cycle rarely has more than one gamepad with active fingers, so the groups are searched linearly.
+    QList<TouchpadTrajectory> trajectories = m_touchpadTracker.takeTrajectories();
+    QList<std::pair<SDL_JoystickID, QList<TouchpadTrajectory>>> groups;
+    for (TouchpadTrajectory& trajectory : trajectories) {
+        auto group = std::find_if(groups.begin(), groups.end(), [&trajectory](const auto& entry) {
+            return entry.first == trajectory.device;
+        });
+        if (group == groups.end()) {
+            groups.append({trajectory.device, {}});
+            group = groups.end() - 1;
+        }
+
+        trajectory.slot = m_devices.slot(trajectory.device);
+        group->second.append(std::move(trajectory));
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    for (const auto& group : std::as_const(groups)) {
+        const DeviceSlot slot = m_devices.slot(group.first);
+        route(appInstance, GamepadTouchpadTrajectory, group.first, [&group, slot]() {
+            return new QSDLGamepadTouchpadTrajectoryEvent(group.first, slot, group.second);
+        });
+    }
+}
+
+void SDLEventManager::syncOrientationFusion() {
+    if (!m_orientationDirty.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    bool enabled;
+    float rate;
+    {
+        QMutexLocker locker(&m_orientationMutex);
+        m_orientationDirty.store(false, std::memory_order_relaxed);
+        enabled = m_orientationFusion;
+        rate = m_orientationRate;
+        m_orientationFilter.setSettings(m_orientationSettings);
+    }
+
+    m_orientationPeriod = (rate > 0)? static_cast<Uint64>(SDL_NS_PER_SECOND / rate): 0;
+    if (enabled != m_orientationFusionActive) {
+        m_orientationFusionActive = enabled;
+        m_orientationFilter.clear();
+    }
+}
+
+void SDLEventManager::deliverOrientations(QCoreApplication *appInstance) {
+    if (!m_orientationFusionActive) {
+        return;
+    }
+
+    m_orientationFilter.process();
+    if (!m_orientationFilter.hasUpdates()) {
+        return;
+    }
+
+    const Uint64 now = SDL_GetTicksNS();
+    if (now - m_lastOrientationPublish < m_orientationPeriod) {
+        return;
+    }
+
+    m_lastOrientationPublish = now;
+    QList<OrientationState> updates = m_orientationFilter.takeUpdates();
+
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    for (OrientationState& state : updates) {
+        state.slot = m_devices.slot(state.device);
+        route(appInstance, GamepadOrientation, state.device, [&state]() {
+            return new QSDLGamepadOrientationEvent(state);
+        });
+    }
+}
+
+void SDLEventManager::bufferSensorEvent(const SDL_GamepadSensorEvent &event) {
+    const quint64 key = (static_cast<quint64>(event.which) << 32) | static_cast<quint32>(event.sensor);
+
+    auto it = m_sensorBuffers.find(key);
+    if (it == m_sensorBuffers.end()) {
+        it = m_sensorBuffers.insert(key, GamepadSensorBuffer(m_sensorBufferCapacity.load(std::memory_order_relaxed)));
+    }
+
+    it->push((event.sensor_timestamp)? event.sensor_timestamp: event.timestamp,
+             event.data[0], event.data[1], event.data[2]);
+    m_sensorSamplesPending = true;
+}
+
+QSDLEvent *SDLEventManager::wrapEvent(const SDL_Event &event) {
+    QSDLEvent* wrapped = QSDLEventFactory::create(event);
+    wrapped->markPosted(m_postTimestamp, m_postMetrics);
+    recordPosted(event);
+    if (QSDLEventBatch::isDeviceEvent(event)) {
+        wrapped->setDeviceSlot(m_devices.slot(event.jdevice.which));
+    }
+
+    if (event.type == SDL_EVENT_GAMEPAD_AXIS_MOTION && !m_axisMerges.isEmpty()) {
+        auto it = m_axisMerges.constFind(axisKey(event.gaxis));
+        if (it != m_axisMerges.constEnd()) {
+            static_cast<QSDLGamepadAxisEvent*>(wrapped)->setCoalescedSamples(it->samples, it->firstTimestamp);
+        }
+    }
+
+    return wrapped;
+}
+
+void SDLEventManager::deliverCycle(QCoreApplication *appInstance) {
+    if (m_cycle.isEmpty()) {
+        return;
+    }
+
+    if (m_axisFilterActive && m_axisFilter.process(m_cycle)) {
+        m_hasDeadEvents = true;
+    }
+
+    if (m_actionMappingActive) {
+        mapActions();
+    }
+
+    if (m_hasDeadEvents) {
+        m_cycle.removeIf([](const SDL_Event& event) {
+            return event.type == SDL_EVENT_FIRST;
+        });
+        m_hasDeadEvents = false;
+    }
+
+    measureCycle();
+
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    if (!m_handlerList.isEmpty()) {
+        invokeHandlers();
+    }
+
+    // Events are counted by the metrics where they are posted, the events without receivers are counted as unposted.
+    quint64 unposted = 0;
+    const DeliveryMode deliveryMode = m_deliveryMode.load(std::memory_order_relaxed);
+    if (deliveryMode == DeliveryMode::Direct) {
+        unposted = static_cast<quint64>(m_cycle.size());
+        m_cycle.clear();
+    } else if (deliveryMode == DeliveryMode::Batched) {
+        unposted = deliverBatch(appInstance);
+    } else {
+        for (const SDL_Event& event : std::as_const(m_cycle)) {
+            const SDL_JoystickID device = (QSDLEventBatch::isDeviceEvent(event))? event.jdevice.which: 0;
+            const bool posted = route(appInstance, eventTypeFlag(event.type), device, [this, &event]() {
+                return wrapEvent(event);
+            });
+            unposted += !posted;
+        }
+        m_cycle.clear();
+    }
+
+    if (m_postMetrics) {
+        m_postMetrics->recordCycle(m_cyclePosted);
+        m_postMetrics->recordUnposted(unposted);
+    }
+
+    m_axisMerges.clear();
+}
+
+void SDLEventManager::measureCycle() {
+    m_postTimestamp = SDL_GetTicksNS();
+
+    if (!m_metricsEnabled.load(std::memory_order_relaxed)) {
+        m_postMetrics.reset();
+        return;
+    }
+
+    m_postMetrics = m_metrics;
+    m_cyclePosted = 0;
+}
+
+void SDLEventManager::recordPosted(const SDL_Event &event) {
+    if (!m_postMetrics) {
+        return;
+    }
+
+    const Uint64 timestamp = event.common.timestamp;
+    m_postMetrics->recordPosted(event.type, (m_postTimestamp > timestamp)? m_postTimestamp - timestamp: 0);
+    ++m_cyclePosted;
+}
+
+void SDLEventManager::reportMetrics() {
+    const int interval = m_metricsInterval.load(std::memory_order_relaxed);
+    if (!m_metricsEnabled.load(std::memory_order_relaxed) || interval <= 0) {
+        return;
+    }
+
+    const Uint64 now = SDL_GetTicksNS();
+    if (now - m_lastMetricsReport < SDL_MS_TO_NS(static_cast<Uint64>(interval))) {
+        return;
+    }
+
+    m_lastMetricsReport = now;
+    emit metricsUpdated(m_metrics->snapshot());
+}
+
+quint64 SDLEventManager::deliverBatch(QCoreApplication *appInstance) {
+    // The batches carry raw SDL events, so the merged samples are attached to them separately.
+    m_batchAxisSamples.clear();
+    for (auto it = m_axisMerges.cbegin(); it != m_axisMerges.cend(); ++it) {
+        if (it->samples > 1) {
+            m_batchAxisSamples.insert(it.key(), {it->samples, it->firstTimestamp});
+        }
+    }
+
+    if (!m_boundDevices.isEmpty()) {
+        deliverBoundBatches();
+        if (m_cycle.isEmpty()) {
+            return 0;
+        }
+    }
+
+    if (!m_routingActive) {
+        dispatchEvent(appInstance, createBatch(std::move(m_cycle)));
+        m_cycle = {};
+        m_cycle.reserve(CYCLE_RESERVE);
+        return 0;
+    }
+
+    quint64 unposted = 0;
+    if (m_postMetrics) {
+        for (const SDL_Event& event : std::as_const(m_cycle)) {
+            const SDL_JoystickID device = (QSDLEventBatch::isDeviceEvent(event))? event.jdevice.which: 0;
+            const bool matched = std::any_of(m_routeList.cbegin(), m_routeList.cend(),
+                                             [&event, device](const Subscription& subscription) {
+                return (subscription.types & eventTypeFlag(event.type)) && subscription.devices.matches(device);
+            });
+            unposted += !matched;
+        }
+    }
+
+    // Each subscriber receives its own batch with the matching events only.
+    for (const Subscription& subscription : std::as_const(m_routeList)) {
+        QList<SDL_Event> events;
+        for (const SDL_Event& event : std::as_const(m_cycle)) {
+            const SDL_JoystickID device = (QSDLEventBatch::isDeviceEvent(event))? event.jdevice.which: 0;
+            if ((subscription.types & eventTypeFlag(event.type)) && subscription.devices.matches(device)) {
+                events.append(event);
+            }
+        }
+
+        if (!events.isEmpty()) {
+            dispatchEvent(subscription.receiver, createBatch(std::move(events)));
+        }
+    }
+
+    m_cycle.clear();
+    return unposted;
+}
+
+QSDLEventBatch *SDLEventManager::createBatch(QList<SDL_Event> events) {
+    if (m_postMetrics) {
+        for (const SDL_Event& event : std::as_const(events)) {
+            recordPosted(event);
+        }
+    }
+
+    auto batch = new QSDLEventBatch(std::move(events));
+    batch->markPosted(m_postTimestamp, m_postMetrics);
+    batch->setDeviceSlots(m_devices.table());
+    batch->setAxisSamples(m_batchAxisSamples);
+    return batch;
+}
+
+void SDLEventManager::invokeHandlers() {
+    for (const SDL_Event& event : std::as_const(m_cycle)) {
+        const EventTypeFlag type = eventTypeFlag(event.type);
+        for (const Handler& handler : std::as_const(m_handlerList)) {
+            if (handler.types & type) {
+                handler.callback(event);
+            }
+        }
+    }
+}
+
+void SDLEventManager::deliverBoundBatches() {
+    QHash<QObject*, QList<SDL_Event>> batches;
+    m_cycle.removeIf([this, &batches](const SDL_Event& event) {
+        if (!QSDLEventBatch::isDeviceEvent(event)) {
+            return false;
+        }
+
+        auto it = m_boundDevices.constFind(event.jdevice.which);
+        if (it == m_boundDevices.constEnd()) {
+            return false;
+        }
+
+        batches[it.value()].append(event);
+        return true;
+    });
+
+    for (auto it = batches.begin(); it != batches.end(); ++it) {
+        dispatchEvent(it.key(), createBatch(std::move(it.value())));
+    }
+}
+
+template<class Factory>
+bool SDLEventManager::route(QCoreApplication *appInstance, EventTypeFlag type, SDL_JoystickID device,
+                            const Factory &create) {
+    if (device && !m_boundDevices.isEmpty()) {
+        auto bound = m_boundDevices.constFind(device);
+        if (bound != m_boundDevices.constEnd()) {
+            dispatchEvent(bound.value(), create());
+            return true;
+        }
+    }
+
+    if (!m_routingActive) {
+        dispatchEvent(appInstance, create());
+        return true;
+    }
+
+    bool posted = false;
+    for (const Route& target : std::as_const(m_routes[std::countr_zero(static_cast<quint32>(type))])) {
+        if (target.devices->matches(device)) {
+            dispatchEvent(target.receiver, create());
+            posted = true;
+        }
+    }
+
+    return posted;
+}
+
+void SDLEventManager::updateRoutes() {
+    if (!m_routesDirty) {
+        return;
+    }
+
+    m_routesDirty = false;
+    m_routeList = m_subscriptions;
+    m_handlerList = m_handlers;
+    m_routingActive = !m_routeList.isEmpty();
+
+    m_bindingList = m_bindings;
+    m_boundDevices.clear();
+    if (!m_bindingList.isEmpty()) {
+        for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+            if (QObject* target = resolveBinding(entry.id)) {
+                m_boundDevices.insert(entry.id, target);
+            }
+        }
+    }
+
+    for (auto& routes : m_routes) {
+        routes.clear();
+    }
+
+    for (const Subscription& subscription : std::as_const(m_routeList)) {
+        for (int bit = 0; bit < EVENT_TYPE_FLAGS_COUNT; ++bit) {
+            if (subscription.types & static_cast<EventTypeFlag>(1u << bit)) {
+                m_routes[bit].append({subscription.receiver, &subscription.devices});
+            }
+        }
+    }
+}
+
+void SDLEventManager::deliverSensorBlocks(QCoreApplication *appInstance) {
+    if (!m_sensorSamplesPending) {
+        return;
+    }
+
+    const Uint64 now = SDL_GetTicksNS();
+    const Uint64 interval = SDL_MS_TO_NS(static_cast<Uint64>(m_sensorBlockInterval.load(std::memory_order_relaxed)));
+    if (now - m_lastSensorFlush < interval) {
+        return;
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    for (auto it = m_sensorBuffers.begin(); it != m_sensorBuffers.end(); ++it) {
+        postSensorBlock(appInstance, it.key(), it.value());
+    }
+
+    m_lastSensorFlush = now;
+    m_sensorSamplesPending = false;
+}
+
+void SDLEventManager::flushSensorBlocks(SDL_JoystickID device) {
+    if (m_sensorBuffers.isEmpty()) {
+        return;
+    }
+
+    auto appInstance = QCoreApplication::instance();
+    QMutexLocker locker(&m_routesMutex);
+    updateRoutes();
+
+    for (auto it = m_sensorBuffers.begin(); it != m_sensorBuffers.end();) {
+        if (static_cast<SDL_JoystickID>(it.key() >> 32) != device) {
+            ++it;
+            continue;
+        }
+
+        if (appInstance) {
+            postSensorBlock(appInstance, it.key(), it.value());
+        }
+        it = m_sensorBuffers.erase(it);
+    }
+}
+
+void SDLEventManager::postSensorBlock(QCoreApplication *appInstance, quint64 key, GamepadSensorBuffer &buffer) {
+    if (buffer.isEmpty()) {
+        return;
+    }
+
+    const auto device = static_cast<SDL_JoystickID>(key >> 32);
+    const auto sensor = static_cast<SDL_SensorType>(static_cast<qint32>(key & 0xFFFFFFFF));
+
+    QList<Uint64> timestamps;
+    QList<float> x, y, z;
+    const quint64 dropped = buffer.takeBlock(timestamps, x, y, z);
+
+    route(appInstance, SensorBlock, device, [&]() {
+        return new QSDLGamepadSensorBlockEvent(device, sensor, timestamps, x, y, z, dropped);
+    });
+}
+
+SDLEventManager::EventTypeFlag SDLEventManager::eventTypeFlag(Uint32 type) {
+    return static_cast<EventTypeFlag>(QSDLEventFactory::descriptor(type).group);
+}
+
+quint64 SDLEventManager::axisKey(const SDL_GamepadAxisEvent &event) {
+    return QSDLEventBatch::axisKey(event);
+}
+
+int SDLEventManager::timeoutUntil(Uint64 now, Uint64 deadline) {
+    if (deadline <= now) {
+        return 0;
+    }
+
+    // Rounded up, a truncated timeout of 0 ms would poll without waiting until the deadline.
+    const Uint64 remaining = (deadline - now + SDL_NS_PER_MS - 1) / SDL_NS_PER_MS;
+    return static_cast<int>(std::min<Uint64>(remaining, std::numeric_limits<int>::max()));
+}
+
+int SDLEventManager::pendingTimeout() const {
+    const Uint64 now = SDL_GetTicksNS();
+    int timeout = -1;
+
+    if (m_sensorSamplesPending) {
+        const Uint64 interval = SDL_MS_TO_NS(static_cast<Uint64>(m_sensorBlockInterval.load(std::memory_order_relaxed)));
+        timeout = timeoutUntil(now, m_lastSensorFlush + interval);
+    }
+
+    if (m_orientationFusionActive && m_orientationFilter.hasUpdates()) {
+        const int orientationTimeout = timeoutUntil(now, m_lastOrientationPublish + m_orientationPeriod);
+        timeout = (timeout < 0)? orientationTimeout: std::min(timeout, orientationTimeout);
+    }
+
+    const int metricsInterval = m_metricsInterval.load(std::memory_order_relaxed);
+    if (m_metricsEnabled.load(std::memory_order_relaxed) && metricsInterval > 0) {
+        const Uint64 deadline = m_lastMetricsReport + SDL_MS_TO_NS(static_cast<Uint64>(metricsInterval));
+        const int metricsTimeout = timeoutUntil(now, deadline);
+        timeout = (timeout < 0)? metricsTimeout: std::min(timeout, metricsTimeout);
+    }
+
+    if (m_replay) {
+        int replayTimeout = 0;
+        if (m_replayHasEvent && m_replaySpeed > 0) {
+            replayTimeout = timeoutUntil(now, replayDueTime(m_replayEvent.common.timestamp));
+        }
+
+        timeout = (timeout < 0)? replayTimeout: std::min(timeout, replayTimeout);
+    }
+
+    return timeout;
+}
+
+void SDLEventManager::recordCycle() {
+    if (!m_recording.load(std::memory_order_relaxed) && m_recordBuffer.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker locker(&m_captureMutex);
+    if (!m_recorder) {
+        m_recordedBy = nullptr;
+        m_recordBuffer.clear();
+        return;
+    }
+
+    if (m_recorder != m_recordedBy) {
+        m_recordedBy = m_recorder;
+
+        const Uint64 now = SDL_GetTicksNS();
+        for (const DeviceSlotMap::Entry& entry : m_devices.entries()) {
+            if (!entry.joystick && !m_replayDevices.contains(entry.id)) {
+                m_recorder->writeDevice(entry.id, now);
+            }
+        }
+    }
+
+    for (const SDL_Event& event : std::as_const(m_recordBuffer)) {
+        if (event.type == SDL_EVENT_GAMEPAD_ADDED) {
+            m_recorder->writeDevice(event.gdevice.which, event.gdevice.timestamp);
+        }
+
+        m_recorder->writeEvent(event);
+    }
+
+    m_recorder->commit();
+    m_recordBuffer.clear();
+}
+
+void SDLEventManager::syncReplay() {
+    if (!m_replayChanged.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::unique_ptr<InputReplay> replay;
+    double speed;
+    {
+        QMutexLocker locker(&m_captureMutex);
+        m_replayChanged.store(false, std::memory_order_relaxed);
+        replay = std::move(m_pendingReplay);
+        speed = m_pendingReplaySpeed;
+    }
+
+    finishReplay();
+
+    if (replay) {
+        m_replay = std::move(replay);
+        m_replaySpeed = speed;
+        m_replayStart = SDL_GetTicksNS();
+        m_replayStarted = false;
+        m_replayHasEvent = false;
+        m_replaying.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool SDLEventManager::replayEvents() {
+    const Uint64 now = SDL_GetTicksNS();
+    qsizetype processed = 0;
+
+    while (processed < REPLAY_CHUNK) {
+        if (!m_replayHasEvent) {
+            InputReplay::RecordedDevice device;
+            auto kind = m_replay->next(m_replayEvent, device);
+
+            // Gamepads that were connected before the recording started are described by device records only.
+            while (kind == InputRecorder::RecordKind::Device) {
+                m_replayDeviceInfo.insert(device.id, device.toDeviceInfo());
+                if (!m_devices.contains(device.id)) {
+                    SDL_Event added = gamepadDeviceEvent(SDL_EVENT_GAMEPAD_ADDED, device.id);
+                    processReplayedEvent(added);
+                    ++processed;
+                }
+                kind = m_replay->next(m_replayEvent, device);
+            }
+
+            if (kind == InputRecorder::RecordKind::End) {
+                if (m_replay->isCorrupted()) {
+                    qWarning() << "SDLEventManager: the replayed recording is damaged, the replay is stopped";
+                }
+
+                finishReplay();
+                emit replayFinished();
+                break;
+            }
+
+            if (!m_replayStarted) {
+                m_replayStarted = true;
+                m_replayFirst = m_replayEvent.common.timestamp;
+            }
+            m_replayHasEvent = true;
+        }
+
+        const Uint64 due = replayDueTime(m_replayEvent.common.timestamp);
+        if (due > now) {
+            break;
+        }
+
+        SDL_Event event = m_replayEvent;
+        event.common.timestamp = std::max(due, m_replayStart);
+        m_replayHasEvent = false;
+
+        processReplayedEvent(event);
+        ++processed;
+    }
+
+    return processed;
+}
+
+void SDLEventManager::processReplayedEvent(const SDL_Event &event) {
+    const SDL_JoystickID device = event.gdevice.which;
+
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_ADDED:
+        // Already described by a device record, or used by a real gamepad.
+        if (m_devices.contains(device)) {
+            return;
+        }
+        m_replayDevices.insert(device);
+        break;
+
+    case SDL_EVENT_GAMEPAD_REMOVED:
+        if (!m_replayDevices.remove(device)) {
+            return;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    // Events of real gamepads with the same id would be mixed with the recording, so they are skipped.
+    if (QSDLEventBatch::isDeviceEvent(event) && !m_replayDevices.contains(device) &&
+        event.type != SDL_EVENT_GAMEPAD_REMOVED) {
+        return;
+    }
+
+    m_processingReplay = true;
+    processEvent(event);
+    m_processingReplay = false;
+}
+
+Uint64 SDLEventManager::replayDueTime(Uint64 timestamp) const {
+    if (m_replaySpeed <= 0) {
+        return 0;
+    }
+
+    const Uint64 offset = (timestamp > m_replayFirst)? timestamp - m_replayFirst: 0;
+    return m_replayStart + static_cast<Uint64>(offset / m_replaySpeed);
+}
+
+void SDLEventManager::finishReplay() {
+    if (!m_replay) {
+        return;
+    }
+
+    const QList<SDL_JoystickID> devices = m_replayDevices.values();
+    for (SDL_JoystickID device : devices) {
+        processReplayedEvent(gamepadDeviceEvent(SDL_EVENT_GAMEPAD_REMOVED, device));
+    }
+
+    m_replay.reset();
+    m_replayHasEvent = false;
+    m_replayDeviceInfo.clear();
+
+    QMutexLocker locker(&m_captureMutex);
+    m_replaying.store(m_replayChanged.load(std::memory_order_relaxed) && m_pendingReplay, std::memory_order_relaxed);
+}
+
+void SDLEventManager::setRecorder(InputRecorder *recorder) {
+    QMutexLocker locker(&m_captureMutex);
+    m_recorder = recorder;
+    m_recording.store(recorder != nullptr, std::memory_order_relaxed);
+}
+
+bool SDLEventManager::startReplay(const QString &path, double speed) {
+    auto replay = std::make_unique<InputReplay>();
+    if (!replay->open(path)) {
+        return false;
+    }
+
+    {
+        QMutexLocker locker(&m_captureMutex);
+        m_pendingReplay = std::move(replay);
+        m_pendingReplaySpeed = std::max(speed, 0.0);
+        m_replayChanged.store(true, std::memory_order_release);
+        m_replaying.store(true, std::memory_order_relaxed);
+    }
+
+    wakeUp();
+    return true;
+}
+
+void SDLEventManager::stopReplay() {
+    {
+        QMutexLocker locker(&m_captureMutex);
+        m_pendingReplay.reset();
+        m_replayChanged.store(true, std::memory_order_release);
+    }
+
+    wakeUp();
+}
+
+bool SDLEventManager::isReplaying() const {
+    return m_replaying.load(std::memory_order_relaxed);
+}
+
+bool SDLEventManager::metricsEnabled() const {
+    return m_metricsEnabled.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setMetricsEnabled(bool newMetricsEnabled) {
+    m_metricsEnabled.store(newMetricsEnabled, std::memory_order_relaxed);
+    wakeUp();
+}
+
+int SDLEventManager::metricsInterval() const {
+    return m_metricsInterval.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setMetricsInterval(int newMetricsInterval) {
+    m_metricsInterval.store(std::max(newMetricsInterval, 0), std::memory_order_relaxed);
+    wakeUp();
+}
+
+SDLEventMetricsSnapshot SDLEventManager::metrics() const {
+    return m_metrics->snapshot();
+}
+
+void SDLEventManager::resetMetrics() {
+    m_metrics->reset();
+}
+
+bool SDLEventManager::rumble(SDL_JoystickID device, Uint16 lowFrequency, Uint16 highFrequency, Uint32 duration) {
+    return queueOutput({device, OutputCommand::Rumble, lowFrequency, highFrequency, duration});
+}
+
+bool SDLEventManager::rumbleTriggers(SDL_JoystickID device, Uint16 left, Uint16 right, Uint32 duration) {
+    return queueOutput({device, OutputCommand::TriggerRumble, left, right, duration});
+}
+
+bool SDLEventManager::setLED(SDL_JoystickID device, Uint8 red, Uint8 green, Uint8 blue) {
+    return queueOutput({device, OutputCommand::LED, Uint16((red << 8) | green), blue, 0});
+}
+
+std::shared_ptr<const DeviceInfo> SDLEventManager::deviceInfo(SDL_JoystickID device) const {
+    QMutexLocker locker(&m_devicesMutex);
+    for (const auto& info : m_deviceInfos) {
+        if (info && info->id == device) {
+            return info;
+        }
+    }
+
+    return {};
+}
+
+std::shared_ptr<const DeviceInfo> SDLEventManager::deviceInfo(DeviceSlot slot) const {
+    QMutexLocker locker(&m_devicesMutex);
+    if (!slot.isValid() || slot.index >= m_deviceInfos.size()) {
+        return {};
+    }
+
+    const auto& info = m_deviceInfos[slot.index];
+    return (info && info->slot == slot)? info: nullptr;
+}
+
+QList<std::shared_ptr<const DeviceInfo>> SDLEventManager::devices() const {
+    QList<std::shared_ptr<const DeviceInfo>> result;
+
+    QMutexLocker locker(&m_devicesMutex);
+    for (const auto& info : m_deviceInfos) {
+        if (info) {
+            result.append(info);
+        }
+    }
+
+    return result;
+}
+
+quint64 SDLEventManager::droppedOutputCommands() const {
+    return m_output.dropped();
+}
+
+SDLEventManager::EventCategories SDLEventManager::enabledEventCategories() const {
+    QMutexLocker locker(&m_filtersMutex);
+    return m_eventCategories;
+}
+
+void SDLEventManager::setEnabledEventCategories(EventCategories newCategories) {
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_eventCategories = newCategories;
+        m_filtersDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+DeviceAllowlist SDLEventManager::deviceAllowlist() const {
+    QMutexLocker locker(&m_filtersMutex);
+    return m_deviceAllowlist;
+}
+
+void SDLEventManager::setDeviceAllowlist(const DeviceAllowlist &newAllowlist) {
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_deviceAllowlist = newAllowlist;
+        m_filtersDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+int SDLEventManager::eventDelay() const {
+    return m_eventDelay;
+}
+
+void SDLEventManager::setEventDelay(int newEventDelay) {
     m_eventDelay = newEventDelay;
 }
+
+SDLEventManager::WaitMode SDLEventManager::waitMode() const {
+    return m_waitMode.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setWaitMode(WaitMode newWaitMode) {
+    m_waitMode.store(newWaitMode, std::memory_order_relaxed);
+    wakeUp();
+}
+
+SDLEventManager::DeliveryMode SDLEventManager::deliveryMode() const {
+    return m_deliveryMode.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setDeliveryMode(DeliveryMode newDeliveryMode) {
+    m_deliveryMode.store(newDeliveryMode, std::memory_order_relaxed);
+}
+
+bool SDLEventManager::axisCoalescing() const {
+    return m_axisCoalescing.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setAxisCoalescing(bool newAxisCoalescing) {
+    m_axisCoalescing.store(newAxisCoalescing, std::memory_order_relaxed);
+}
+
+int SDLEventManager::addEventHandler(const EventHandler &handler, EventMask types) {
+    if (!handler) {
+        return 0;
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    Handler entry;
+    entry.id = m_nextHandlerId++;
+    entry.types = types;
+    entry.callback = handler;
+
+    m_handlers.append(entry);
+    m_routesDirty = true;
+    return entry.id;
+}
+
+void SDLEventManager::removeEventHandler(int id) {
+    QMutexLocker locker(&m_routesMutex);
+    const qsizetype removed = m_handlers.removeIf([id](const Handler& handler) {
+        return handler.id == id;
+    });
+
+    if (removed) {
+        m_routesDirty = true;
+    }
+}
+
+int SDLEventManager::requestSensor(SDL_SensorType sensor, float rate, const DeviceFilter &devices) {
+    int id = 0;
+    {
+        QMutexLocker locker(&m_sensorMutex);
+        SensorRequest request;
+        request.id = id = m_nextSensorRequestId++;
+        request.sensor = sensor;
+        request.rate = std::max(rate, 0.0f);
+        request.devices = devices;
+
+        m_sensorRequests.append(request);
+        m_sensorRequestsDirty.store(true, std::memory_order_release);
+    }
+
+    wakeUp();
+    return id;
+}
+
+void SDLEventManager::releaseSensor(int id) {
+    qsizetype removed = 0;
+    {
+        QMutexLocker locker(&m_sensorMutex);
+        removed = m_sensorRequests.removeIf([id](const SensorRequest& request) {
+            return request.id == id;
+        });
+
+        if (removed) {
+            m_sensorRequestsDirty.store(true, std::memory_order_release);
+        }
+    }
+
+    if (removed) {
+        wakeUp();
+    }
+}
+
+bool SDLEventManager::DeviceFilter::matches(SDL_JoystickID device) const {
+    if (devices.isEmpty()) {
+        return true;
+    }
+
+    return device && devices.contains(device);
+}
+
+SDLEventManager::DeviceBinding SDLEventManager::DeviceBinding::player(int playerIndex) {
+    DeviceBinding binding;
+    binding.playerIndex = playerIndex;
+    return binding;
+}
+
+SDLEventManager::DeviceBinding SDLEventManager::DeviceBinding::device(SDL_JoystickID device) {
+    DeviceBinding binding;
+    binding.guid = SDL_GetGamepadGUIDForID(device);
+    if (SDL_Gamepad* gamepad = SDL_GetGamepadFromID(device)) {
+        binding.serial = QByteArray(SDL_GetGamepadSerial(gamepad));
+    }
+    return binding;
+}
+
+bool SDLEventManager::DeviceBinding::isNull() const {
+    static const SDL_GUID zero {};
+    return playerIndex < 0 && serial.isEmpty() && !std::memcmp(guid.data, zero.data, sizeof(guid.data));
+}
+
+bool SDLEventManager::DeviceBinding::matches(int playerIndex, const SDL_GUID &guid, const QByteArray &serial) const {
+    if (isNull()) {
+        return false;
+    }
+
+    static const SDL_GUID zero {};
+    if (std::memcmp(this->guid.data, zero.data, sizeof(guid.data)) &&
+        std::memcmp(this->guid.data, guid.data, sizeof(guid.data))) {
+        return false;
+    }
+
+    return (this->playerIndex < 0 || this->playerIndex == playerIndex) &&
+           (this->serial.isEmpty() || this->serial == serial);
+}
+
+bool SDLEventManager::DeviceBinding::operator==(const DeviceBinding &other) const {
+    return playerIndex == other.playerIndex && serial == other.serial &&
+           !std::memcmp(guid.data, other.guid.data, sizeof(guid.data));
+}
+
+QObject *SDLEventManager::resolveBinding(SDL_JoystickID device) const {
+    int playerIndex = SDL_GetGamepadPlayerIndexForID(device);
+    SDL_GUID guid = SDL_GetGamepadGUIDForID(device);
+
+    // Replayed gamepads are matched by the identity stored in the recording.
+    if (m_replayDevices.contains(device)) {
+        const std::shared_ptr<const DeviceInfo> info = m_devices.info(device);
+        playerIndex = (info)? info->playerIndex: -1;
+        guid = (info)? info->guid: SDL_GUID {};
+    }
+
+    QByteArray serial;
+    if (SDL_Gamepad* gamepad = m_devices.gamepad(device)) {
+        serial = QByteArray(SDL_GetGamepadSerial(gamepad));
+    }
+
+    for (const Binding& binding : std::as_const(m_bindingList)) {
+        if (binding.key.matches(playerIndex, guid, serial)) {
+            return binding.target;
+        }
+    }
+
+    return nullptr;
+}
+
+void SDLEventManager::releaseBindings() {
+    for (SDL_JoystickID device : std::as_const(m_releasedBindings)) {
+        // A replay may register the same id again within one cycle.
+        if (!m_devices.contains(device)) {
+            m_boundDevices.remove(device);
+        }
+    }
+
+    m_releasedBindings.clear();
+}
+
+void SDLEventManager::bindDevice(const DeviceBinding &binding, QObject *target) {
+    if (!target || binding.isNull()) {
+        return;
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    for (Binding& existing : m_bindings) {
+        if (existing.key == binding) {
+            disconnect(existing.destroyedConnection);
+            existing.target = target;
+            existing.destroyedConnection = connect(target, &QObject::destroyed, this, [this, target]() {
+                unbindTarget(target);
+            }, Qt::DirectConnection);
+            m_routesDirty = true;
+            return;
+        }
+    }
+
+    Binding entry;
+    entry.key = binding;
+    entry.target = target;
+    entry.destroyedConnection = connect(target, &QObject::destroyed, this, [this, target]() {
+        unbindTarget(target);
+    }, Qt::DirectConnection);
+
+    m_bindings.append(entry);
+    m_routesDirty = true;
+}
+
+void SDLEventManager::unbindDevice(const DeviceBinding &binding) {
+    QMutexLocker locker(&m_routesMutex);
+    for (qsizetype index = 0; index < m_bindings.size(); ++index) {
+        if (m_bindings[index].key == binding) {
+            disconnect(m_bindings[index].destroyedConnection);
+            m_bindings.removeAt(index);
+            m_routesDirty = true;
+            return;
+        }
+    }
+}
+
+void SDLEventManager::unbindTarget(QObject *target) {
+    QMutexLocker locker(&m_routesMutex);
+    const qsizetype removed = m_bindings.removeIf([target](const Binding& binding) {
+        if (binding.target != target) {
+            return false;
+        }
+
+        disconnect(binding.destroyedConnection);
+        return true;
+    });
+
+    if (removed) {
+        m_routesDirty = true;
+    }
+}
+
+void SDLEventManager::subscribe(QObject *receiver, EventMask types, const DeviceFilter &devices) {
+    if (!receiver) {
+        return;
+    }
+
+    QMutexLocker locker(&m_routesMutex);
+    for (Subscription& subscription : m_subscriptions) {
+        if (subscription.receiver == receiver) {
+            subscription.types = types;
+            subscription.devices = devices;
+            m_routesDirty = true;
+            return;
+        }
+    }
+
+    Subscription subscription;
+    subscription.receiver = receiver;
+    subscription.types = types;
+    subscription.devices = devices;
+    subscription.destroyedConnection = connect(receiver, &QObject::destroyed, this, [this, receiver]() {
+        unsubscribe(receiver);
+    }, Qt::DirectConnection);
+
+    m_subscriptions.append(subscription);
+    m_routesDirty = true;
+}
+
+void SDLEventManager::unsubscribe(QObject *receiver) {
+    QMutexLocker locker(&m_routesMutex);
+    for (qsizetype index = 0; index < m_subscriptions.size(); ++index) {
+        if (m_subscriptions[index].receiver == receiver) {
+            disconnect(m_subscriptions[index].destroyedConnection);
+            m_subscriptions.removeAt(index);
+            m_routesDirty = true;
+            return;
+        }
+    }
+}
+
+bool SDLEventManager::axisFilterEnabled() const {
+    QMutexLocker locker(&m_filtersMutex);
+    return m_axisFilterEnabled;
+}
+
+void SDLEventManager::setAxisFilterEnabled(bool newAxisFilterEnabled) {
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_axisFilterEnabled = newAxisFilterEnabled;
+        m_filtersDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+GamepadAxisFilter::Settings SDLEventManager::axisFilterSettings() const {
+    QMutexLocker locker(&m_filtersMutex);
+    return m_axisFilterSettings;
+}
+
+void SDLEventManager::setAxisFilterSettings(const GamepadAxisFilter::Settings &newSettings) {
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_axisFilterSettings = newSettings;
+        m_filtersDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+void SDLEventManager::setDeviceAxisFilterSettings(SDL_JoystickID device,
+                                                  const GamepadAxisFilter::Settings &newSettings) {
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_deviceAxisFilterSettings.insert(device, newSettings);
+        m_filtersDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+void SDLEventManager::resetDeviceAxisFilterSettings(SDL_JoystickID device) {
+    {
+        QMutexLocker locker(&m_filtersMutex);
+        m_deviceAxisFilterSettings.remove(device);
+        m_filtersDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+bool SDLEventManager::stateCacheEnabled() const {
+    return m_stateCacheEnabled.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setStateCacheEnabled(bool newStateCacheEnabled) {
+    m_stateCacheEnabled.store(newStateCacheEnabled, std::memory_order_relaxed);
+    wakeUp();
+}
+
+const GamepadStateCache &SDLEventManager::stateCache() const {
+    return m_stateCache;
+}
+
+bool SDLEventManager::sensorBlockDelivery() const {
+    return m_sensorBlockDelivery.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setSensorBlockDelivery(bool newSensorBlockDelivery) {
+    m_sensorBlockDelivery.store(newSensorBlockDelivery, std::memory_order_relaxed);
+}
+
+bool SDLEventManager::joystickStateDelivery() const {
+    return m_joystickStateDelivery.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setJoystickStateDelivery(bool newJoystickStateDelivery) {
+    m_joystickStateDelivery.store(newJoystickStateDelivery, std::memory_order_relaxed);
+}
+
+bool SDLEventManager::touchpadTracking() const {
+    return m_touchpadTracking.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setTouchpadTracking(bool newTouchpadTracking) {
+    m_touchpadTracking.store(newTouchpadTracking, std::memory_order_relaxed);
+}
+
+bool SDLEventManager::orientationFusion() const {
+    QMutexLocker locker(&m_orientationMutex);
+    return m_orientationFusion;
+}
+
+void SDLEventManager::setOrientationFusion(bool newOrientationFusion) {
+    {
+        QMutexLocker locker(&m_orientationMutex);
+        if (m_orientationFusion == newOrientationFusion) {
+            return;
+        }
+
+        // The sensors are requested like any other user of them, so they stay enabled while other requests exist.
+        if (newOrientationFusion) {
+            m_orientationSensorRequests = {requestSensor(SDL_SENSOR_GYRO), requestSensor(SDL_SENSOR_ACCEL)};
+        } else {
+            for (int id : m_orientationSensorRequests) {
+                releaseSensor(id);
+            }
+        }
+
+        m_orientationFusion = newOrientationFusion;
+        m_orientationDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+float SDLEventManager::orientationRate() const {
+    QMutexLocker locker(&m_orientationMutex);
+    return m_orientationRate;
+}
+
+void SDLEventManager::setOrientationRate(float newOrientationRate) {
+    {
+        QMutexLocker locker(&m_orientationMutex);
+        m_orientationRate = std::max(newOrientationRate, 0.0f);
+        m_orientationDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+GamepadOrientationFilter::Settings SDLEventManager::orientationSettings() const {
+    QMutexLocker locker(&m_orientationMutex);
+    return m_orientationSettings;
+}
+
+void SDLEventManager::setOrientationSettings(const GamepadOrientationFilter::Settings &newOrientationSettings) {
+    {
+        QMutexLocker locker(&m_orientationMutex);
+        m_orientationSettings = newOrientationSettings;
+        m_orientationDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+bool SDLEventManager::actionMappingEnabled() const {
+    QMutexLocker locker(&m_actionsMutex);
+    return m_actionMappingEnabled;
+}
+
+void SDLEventManager::setActionMappingEnabled(bool newActionMappingEnabled) {
+    {
+        QMutexLocker locker(&m_actionsMutex);
+        m_actionMappingEnabled = newActionMappingEnabled;
+        m_actionMapsDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+GamepadActionMap SDLEventManager::actionMap() const {
+    QMutexLocker locker(&m_actionsMutex);
+    return m_actionMap;
+}
+
+void SDLEventManager::setActionMap(const GamepadActionMap &newActionMap) {
+    {
+        QMutexLocker locker(&m_actionsMutex);
+        m_actionMap = newActionMap;
+        m_actionMapsDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+void SDLEventManager::setDeviceActionMap(SDL_JoystickID device, const GamepadActionMap &newActionMap) {
+    {
+        QMutexLocker locker(&m_actionsMutex);
+        m_deviceActionMaps.insert(device, newActionMap);
+        m_actionMapsDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+void SDLEventManager::resetDeviceActionMap(SDL_JoystickID device) {
+    {
+        QMutexLocker locker(&m_actionsMutex);
+        m_deviceActionMaps.remove(device);
+        m_actionMapsDirty.store(true, std::memory_order_release);
+    }
+    wakeUp();
+}
+
+int SDLEventManager::sensorBlockInterval() const {
+    return m_sensorBlockInterval.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setSensorBlockInterval(int newSensorBlockInterval) {
+    m_sensorBlockInterval.store(std::max(newSensorBlockInterval, 0), std::memory_order_relaxed);
+    wakeUp();
+}
+
+int SDLEventManager::sensorBufferCapacity() const {
+    return m_sensorBufferCapacity.load(std::memory_order_relaxed);
+}
+
+void SDLEventManager::setSensorBufferCapacity(int newSensorBufferCapacity) {
+    m_sensorBufferCapacity.store(std::max(newSensorBufferCapacity, 1), std::memory_order_relaxed);
+}
 }
@@ -9,14 +9,43 @@
 #ifndef SDLEVENTMANAGER_H
 #define SDLEVENTMANAGER_H
 
+#include <QByteArray>
+#include <QFuture>
 #include <QHash>   // Required for QHash to manage gamepad pointers
+#include <QList>
+#include <QMutex>
+#include <QPointer>
+#include <QSet>
 #include <QThread> // QThread is included for thread management
 #include <SDL3/SDL.h> // SDL3 header for SDL event handling and gamepad management
 #include "global.h"
+#include "deviceallowlist.h"
+#include "deviceslotmap.h"
+#include "gamepadactionmapper.h"
+#include "gamepadaxisfilter.h"
+#include "gamepadorientationfilter.h"
+#include "gamepadtouchpadtracker.h"
+#include "inputrecorder.h"
+#include "inputreplay.h"
+#include "qsdleventbatch.h"
+#include "qsdljoystickstateevent.h"
+#include "gamepadsensorbuffer.h"
+#include "gamepadstatecache.h"
+#include "sdleventmetrics.h"
+#include "spscqueue.h"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+class QCoreApplication;
+class QTimer;
 
 
 namespace QtSDL {
 
+class QSDLEvent;
+
 /**
  * @brief The SDLEventManager class manages SDL events by redirecting them to Qt's event loop.
  *
@@ -27,6 +56,9 @@ namespace QtSDL {
  *
  * It also handles the lifecycle of connected gamepads.
  *
+ * Tools with little input can construct the manager in the `ThreadingMode::Inline` mode instead.
+ * Then no thread is started: SDL is pumped from the Qt event loop of the thread the manager lives in.
+ *
  * @note This manager should be initialized and started early in your application's lifecycle.
  * **Crucially, ensure `QtSDL::init()` has been successfully invoked before using this class.**
  * Call `stop()` and `wait()` during application shutdown.
@@ -36,12 +68,210 @@ class QTSDL_EXPORT SDLEventManager: public QThread
     Q_OBJECT
 
 public:
+    /**
+     * @brief The ThreadingMode enum defines where the manager pumps SDL events.
+     */
+    enum class ThreadingMode {
+        /// The manager runs its own thread and posts events to the receivers. This is the legacy behaviour.
+        Threaded,
+        /// The manager pumps SDL from the Qt event loop of the thread it lives in, and sends events
+        /// to receivers of that thread directly with `QCoreApplication::sendEvent()`. Receivers
+        /// living in other threads still get posted events. Start it with `startInline()`.
+        Inline
+    };
+
+    /**
+     * @brief The WaitMode enum defines how the polling thread waits for new SDL events
+     * between two polling cycles.
+     */
+    enum class WaitMode {
+        /// Drains the SDL queue and then sleeps for `eventDelay()` milliseconds. This is the legacy behaviour.
+        Poll,
+        /// Blocks in `SDL_WaitEventTimeout` until an event arrives. The thread does not wake up while the queue is empty.
+        Wait,
+        /// Waits with a short timeout while input is active and doubles it on each idle cycle up to `eventDelay()`.
+        Adaptive
+    };
+
+    /**
+     * @brief The DeliveryMode enum defines how drained SDL events are posted to the application.
+     */
+    enum class DeliveryMode {
+        /// Each SDL event is wrapped into its own `QSDLEvent` and posted separately. This is the legacy behaviour.
+        PerEvent,
+        /// All SDL events drained in one polling cycle are posted together as a single `QSDLEventBatch`.
+        Batched,
+        /// No SDL events are posted. They reach only the handlers added with `addEventHandler()`,
+        /// which run on the manager thread. Nothing is allocated per SDL event. The handlers receive
+        /// SDL events only, so the events the manager derives from them are still posted to their
+        /// subscribers, and the SDL events folded into them do not reach the handlers:
+        /// - sensor blocks while `sensorBlockDelivery()` is enabled;
+        /// - joystick state packets while `joystickStateDelivery()` is enabled;
+        /// - action events while `actionMappingEnabled()` is enabled;
+        /// - touchpad trajectories while `touchpadTracking()` is enabled;
+        /// - fused orientations while `orientationFusion()` is enabled.
+        Direct
+    };
+
+    /**
+     * @brief The EventTypeFlag enum defines the groups of events a receiver can subscribe to.
+     * @see subscribe
+     */
+    enum EventTypeFlag: quint32 {
+        /// Gamepad connection, disconnection, remapping and update events (`QSDLGamepadEvent`).
+        GamepadDevice = 0x01,
+        /// Gamepad axis motion events (`QSDLGamepadAxisEvent`).
+        GamepadAxis = 0x02,
+        /// Gamepad button events (`QSDLGamepadButtonEvent`).
+        GamepadButton = 0x04,
+        /// Gamepad touchpad events (`QSDLGamepadTouchpadEvent`).
+        GamepadTouchpad = 0x08,
+        /// Gamepad sensor events (`QSDLGamepadSensorEvent`).
+        GamepadSensor = 0x10,
+        /// Blocks of gamepad sensor samples (`QSDLGamepadSensorBlockEvent`).
+        SensorBlock = 0x20,
+        /// All other SDL events, wrapped into a generic `QSDLEvent`.
+        OtherEvents = 0x40,
+        /// Joystick connection, disconnection and update events (`QSDLJoystickEvent`).
+        JoystickDevice = 0x80,
+        /// Joystick axis and ball motion events (`QSDLJoystickAxisEvent`, ball motion as a generic `QSDLEvent`).
+        JoystickAxis = 0x100,
+        /// Joystick button events (`QSDLJoystickButtonEvent`).
+        JoystickButton = 0x200,
+        /// Joystick hat events (`QSDLJoystickHatEvent`).
+        JoystickHat = 0x400,
+        /// Compact joystick state packets (`QSDLJoystickStateEvent`).
+        JoystickStatePacket = 0x800,
+        /// Transitions of mapped actions (`QSDLActionEvent`).
+        GamepadAction = 0x1000,
+        /// Touchpad finger trajectories (`QSDLGamepadTouchpadTrajectoryEvent`).
+        GamepadTouchpadTrajectory = 0x2000,
+        /// Fused gamepad orientations (`QSDLGamepadOrientationEvent`).
+        GamepadOrientation = 0x4000,
+        /// All events.
+        AllEvents = 0x7FFF
+    };
+    Q_DECLARE_FLAGS(EventMask, EventTypeFlag)
+
+    /**
+     * @brief The EventCategory enum defines the categories of SDL events that SDL itself queues.
+     * @see setEnabledEventCategories
+     */
+    enum EventCategory: quint32 {
+        /// Application lifecycle events, including `SDL_EVENT_QUIT` and locale or theme changes.
+        ApplicationEvents = 0x0001,
+        /// Display events.
+        DisplayEvents = 0x0002,
+        /// Window events.
+        WindowEvents = 0x0004,
+        /// Keyboard and text input events.
+        KeyboardEvents = 0x0008,
+        /// Mouse events.
+        MouseEvents = 0x0010,
+        /// Raw joystick events. Joystick connection events are always kept while gamepad events are enabled.
+        JoystickEvents = 0x0020,
+        /// Gamepad events.
+        GamepadEvents = 0x0040,
+        /// Touch and gesture events.
+        TouchEvents = 0x0080,
+        /// Clipboard events.
+        ClipboardEvents = 0x0100,
+        /// Drag and drop events.
+        DropEvents = 0x0200,
+        /// Audio device events.
+        AudioEvents = 0x0400,
+        /// Standalone sensor events.
+        SensorEvents = 0x0800,
+        /// Pen events.
+        PenEvents = 0x1000,
+        /// Camera device events.
+        CameraEvents = 0x2000,
+        /// Render events.
+        RenderEvents = 0x4000,
+        /// Events reserved with `QSDLEventFactory::registerEvents()` or `QSDLEventFactory::registerUserType()`.
+        /// The internal wake-up event is always kept.
+        UserEvents = 0x8000,
+        /// All categories.
+        AllCategories = 0xFFFF
+    };
+    Q_DECLARE_FLAGS(EventCategories, EventCategory)
+
+    /**
+     * @brief The DeviceFilter struct limits a subscription to a set of devices.
+     */
+    struct QTSDL_EXPORT DeviceFilter {
+        /// The SDL joystick instance ids of accepted devices. An empty list accepts all devices and non-device events.
+        QList<SDL_JoystickID> devices;
+
+        /**
+         * @brief Checks whether the filter accepts an event of the device.
+         * @param device The SDL joystick instance id, or 0 for events not related to a device.
+         * @return true if the event passes the filter.
+         */
+        bool matches(SDL_JoystickID device) const;
+    };
+
+    /**
+     * @brief The DeviceBinding struct identifies a gamepad, or a player slot, across reconnections.
+     *
+     * Each field that is set must match. A binding with no fields set matches nothing.
+     * @see bindDevice
+     */
+    struct QTSDL_EXPORT DeviceBinding {
+        /// The player index of the gamepad (`SDL_GetGamepadPlayerIndex()`), or -1 to accept any player.
+        int playerIndex = -1;
+        /// The GUID of the gamepad, or a zero GUID to accept any model.
+        SDL_GUID guid {};
+        /// The serial number of the gamepad, or an empty array to accept any serial number.
+        QByteArray serial;
+
+        /**
+         * @brief Creates a binding of a player slot.
+         * @param playerIndex The player index.
+         * @return The binding that matches the gamepad with the player index.
+         */
+        static DeviceBinding player(int playerIndex);
+
+        /**
+         * @brief Creates a binding of a connected gamepad, that matches it again after a reconnection.
+         *
+         * The binding contains the GUID and, when SDL reports it, the serial number of the gamepad.
+         * Identical gamepads without serial numbers can not be told apart, so they all match.
+         * @param device The SDL joystick instance id of the connected gamepad.
+         * @return The binding of the gamepad.
+         */
+        static DeviceBinding device(SDL_JoystickID device);
+
+        /**
+         * @brief Checks whether the binding has no fields set.
+         */
+        bool isNull() const;
+
+        /**
+         * @brief Checks whether a gamepad matches the binding.
+         * @param playerIndex The player index of the gamepad.
+         * @param guid The GUID of the gamepad.
+         * @param serial The serial number of the gamepad, or an empty array if it is unknown.
+         * @return true if the binding is not null and all its fields match.
+         */
+        bool matches(int playerIndex, const SDL_GUID& guid, const QByteArray& serial) const;
+
+        bool operator==(const DeviceBinding& other) const;
+    };
+
     /**
      * @brief Constructs an SDLEventManager instance.
      * @param parent The parent QObject for memory management.
      */
     SDLEventManager(QObject* parent = nullptr);
 
+    /**
+     * @brief Constructs an SDLEventManager instance with the given threading mode.
+     * @param threadingMode The threading mode. It can not be changed later.
+     * @param parent The parent QObject for memory management.
+     */
+    explicit SDLEventManager(ThreadingMode threadingMode, QObject* parent = nullptr);
+
     /**
      * @brief Destroys the SDLEventManager instance.
      *
@@ -49,15 +279,182 @@ public:
      */
     ~SDLEventManager() override;
 
+    /**
+     * @brief Starts the manager thread in the `ThreadingMode::Threaded` mode.
+     *
+     * In the `ThreadingMode::Inline` mode use `startInline()` instead. The started thread only hands
+     * the start over to `startInline()` in the thread the manager lives in and finishes right away.
+     */
+    using QThread::start;
+
+    /**
+     * @brief Starts pumping SDL events in the `ThreadingMode::Inline` mode.
+     *
+     * The pump runs from the event loop of the thread the manager lives in, so call this method from
+     * that thread. It runs every millisecond while input is active and backs off up to `eventDelay()`
+     * while idle. Events pushed to SDL from other threads wake the pump immediately through an SDL event watch.
+     * In the `ThreadingMode::Threaded` mode this method does nothing, use `start()` instead.
+     */
+    void startInline();
+
+    /**
+     * @brief Starts pumping SDL events once an asynchronous initialization finishes.
+     *
+     * The manager starts from the event loop of the thread it lives in when the future reports success,
+     * see `QtSDL::initAsync()`. Nothing is started if the initialization fails or `stop()` is called first.
+     * The threaded manager starts its thread, and the inline manager calls `startInline()`.
+     * @param initialized The future of the initialization.
+     * @param priority The priority of the manager thread. It is ignored in the inline mode.
+     */
+    void start(const QFuture<bool>& initialized, Priority priority = InheritPriority);
+
     /**
      * @brief Requests the event manager thread to stop its polling loop.
      *
+     * Pushes an internal wake-up event into the SDL queue, so a thread blocked in
+     * `SDL_WaitEventTimeout` returns immediately.
      * Call `wait()` afterwards to ensure thread termination.
      */
     void stop();
 
+    /**
+     * @brief Returns the threading mode chosen at construction.
+     */
+    ThreadingMode threadingMode() const;
+
+    /**
+     * @brief Subscribes a receiver to a subset of events.
+     *
+     * Once at least one receiver is subscribed, the manager stops posting events to
+     * `QCoreApplication::instance()`. Each event is posted only to the receivers whose
+     * @a types and @a devices match it. Events that nobody subscribed to are never allocated.
+     * Events are delivered with `QCoreApplication::postEvent()`, so each receiver handles them
+     * in its own thread. In the `DeliveryMode::Batched` mode each receiver gets its own batch
+     * with the matching events only.
+     *
+     * Subscribing the same receiver again replaces its previous subscription. A receiver is
+     * unsubscribed automatically when it is destroyed.
+     *
+     * This method is thread-safe. The routing table is rebuilt on the manager thread.
+     * @param receiver The object that receives the events.
+     * @param types The groups of events to deliver.
+     * @param devices The devices whose events are delivered.
+     */
+    void subscribe(QObject* receiver, EventMask types = AllEvents, const DeviceFilter& devices = {});
+
+    /**
+     * @brief Removes the subscription of the receiver.
+     *
+     * When the last receiver is unsubscribed, the manager posts events to `QCoreApplication::instance()` again.
+     * This method is thread-safe.
+     * @param receiver The subscribed object.
+     */
+    void unsubscribe(QObject* receiver);
+
+    /**
+     * @brief The EventHandler type is a function that handles SDL events on the manager thread.
+     */
+    using EventHandler = std::function<void (const SDL_Event& event)>;
+
+    /**
+     * @brief Adds a handler that is called synchronously on the manager thread for each delivered event.
+     *
+     * Handlers run right after the events of a polling cycle are drained and processed, with the
+     * same device lifecycle, filters and coalescing as posted events, and before any event is posted.
+     * They do not allocate, so together with `DeliveryMode::Direct` they form the lowest-latency path,
+     * for example to fill an `SPSCQueue` that a render thread reads right before submitting a frame.
+     *
+     * Handlers must be fast and must not call `subscribe()`, `bindDevice()`, `addEventHandler()`
+     * or their counterparts, because the routing lock is held while they run.
+     * This method is thread-safe. The handler is used from the next polling cycle.
+     * @param handler The handler.
+     * @param types The groups of events passed to the handler.
+     * @return The id of the handler for `removeEventHandler()`.
+     */
+    int addEventHandler(const EventHandler& handler, EventMask types = AllEvents);
+
+    /**
+     * @brief Removes a handler. After this method returns, the handler is not running and is not called anymore.
+     * This method is thread-safe.
+     * @param id The id returned by `addEventHandler()`.
+     */
+    void removeEventHandler(int id);
+
+    /**
+     * @brief Binds a gamepad, or a player slot, to a target object.
+     *
+     * All events of the matching gamepads, including their connection and disconnection, are posted
+     * straight to @a target with `QCoreApplication::postEvent()`, so they are handled in the thread
+     * the target lives in. They bypass the subscriptions and the application object. When a gamepad
+     * reconnects and matches the binding again, its events go back to the same target.
+     *
+     * Bindings are checked in the order they were added, and the first matching one wins. A gamepad
+     * is matched when it connects and every time the bindings change. Binding the same @a binding
+     * again replaces its target. A target is unbound automatically when it is destroyed.
+     *
+     * This method is thread-safe.
+     * @param binding The gamepad or the player slot.
+     * @param target The object that receives the events, usually a worker living in its own `QThread`.
+     */
+    void bindDevice(const DeviceBinding& binding, QObject* target);
+
+    /**
+     * @brief Removes a binding. The events of its gamepads are routed as usual again.
+     * This method is thread-safe.
+     * @param binding The binding passed to `bindDevice()`.
+     */
+    void unbindDevice(const DeviceBinding& binding);
+
+    /**
+     * @brief Removes all bindings of a target. This method is thread-safe.
+     * @param target The bound object.
+     */
+    void unbindTarget(QObject* target);
+
+    /**
+     * @brief Returns the categories of SDL events that are queued by SDL.
+     * @return The enabled categories. The default is `AllCategories`.
+     */
+    EventCategories enabledEventCategories() const;
+
+    /**
+     * @brief Sets the categories of SDL events that are queued by SDL.
+     *
+     * Disabled categories are turned off with `SDL_SetEventEnabled()`, so SDL drops such events
+     * before they reach its queue and the manager never drains, wraps or posts them.
+     * Events of disabled categories that are already queued are discarded.
+     * The categories are applied on the manager thread on the next polling cycle.
+     *
+     * @note `SDL_EventEnabled()` is global state of SDL: the categories also affect other
+     * consumers of the SDL queue in the same process.
+     * @param newCategories The categories to keep.
+     */
+    void setEnabledEventCategories(EventCategories newCategories);
+
+    /**
+     * @brief Returns the devices the manager opens and posts events for.
+     * @return A copy of the current allowlist. The default is an empty allowlist that accepts all devices.
+     */
+    DeviceAllowlist deviceAllowlist() const;
+
+    /**
+     * @brief Limits the gamepads the manager opens and posts events for.
+     *
+     * Gamepads rejected by the allowlist are not opened, and all their events are dropped
+     * right after they are drained from SDL, before any other processing.
+     * When the allowlist changes, opened gamepads that are not accepted anymore are closed
+     * and a `SDL_EVENT_GAMEPAD_REMOVED` event is posted for them; connected gamepads
+     * that become accepted are opened and a `SDL_EVENT_GAMEPAD_ADDED` event is posted.
+     *
+     * This method is thread-safe. The allowlist is applied on the manager thread on the next polling cycle.
+     * @param newAllowlist The new allowlist.
+     */
+    void setDeviceAllowlist(const DeviceAllowlist& newAllowlist);
+
     /**
      * @brief Returns the current delay (in milliseconds) applied after each SDL event polling cycle.
+     *
+     * In the `WaitMode::Adaptive` mode this value is the upper limit of the idle back-off.
      * @return The delay in milliseconds.
      */
     int eventDelay() const;
@@ -68,31 +465,1629 @@ public:
      */
     void setEventDelay(int newEventDelay);
 
-protected:
     /**
-     * @brief The main entry point for the event manager thread.
+     * @brief Returns the strategy used to wait for new SDL events.
+     * @return The current wait mode. The default is `WaitMode::Poll`.
+     */
+    WaitMode waitMode() const;
+
+    /**
+     * @brief Sets the strategy used to wait for new SDL events.
+     * @param newWaitMode The new wait mode. It is applied on the next polling cycle.
+     */
+    void setWaitMode(WaitMode newWaitMode);
+
+    /**
+     * @brief Returns how drained SDL events are posted to the application.
+     * @return The current delivery mode. The default is `DeliveryMode::PerEvent`.
+     */
+    DeliveryMode deliveryMode() const;
+
+    /**
+     * @brief Sets how drained SDL events are posted to the application.
      *
-     * Continuously polls for SDL events and posts them to Qt's event queue.
-     * Handles gamepad device lifecycle.
+     * This method is thread-safe. The manager reads the mode once per polling cycle, so the events
+     * of the cycle in progress are still delivered in the previous mode.
+     * @param newDeliveryMode The new delivery mode. It is applied on the next polling cycle.
      */
-    void run() override;
+    void setDeliveryMode(DeliveryMode newDeliveryMode);
 
-private:
     /**
-     * @brief Flag to control the execution loop of the thread.
+     * @brief Checks whether axis motion events are coalesced within a polling cycle.
+     * @return true if the coalescing is enabled. The default is false.
      */
-    volatile bool m_quitFlag = false;
+    bool axisCoalescing() const;
 
     /**
-     * @brief The delay in milliseconds applied after each SDL event polling cycle.
+     * @brief Enables or disables the coalescing of axis motion events.
+     *
+     * When enabled, all `SDL_EVENT_GAMEPAD_AXIS_MOTION` events drained in one polling cycle
+     * for the same gamepad and axis are collapsed into a single event with the most recent value.
+     * The resulting `QSDLGamepadAxisEvent` keeps the number of merged samples and the first and
+     * last timestamps. All other events keep their relative order.
+     * @param newAxisCoalescing true to enable the coalescing.
      */
-    int m_eventDelay = 10;
+    void setAxisCoalescing(bool newAxisCoalescing);
 
     /**
-     * @brief A hash map storing pointers to currently opened `SDL_Gamepad` objects.
+     * @brief Checks whether axis events pass through the deadzone, response curve and hysteresis stage.
+     * @return true if the axis filter is enabled. The default is false.
      */
-    QHash<int, SDL_Gamepad*> m_gamepads;
-};
-} // namespace QtSDL
+    bool axisFilterEnabled() const;
+
+    /**
+     * @brief Enables or disables the axis filter stage.
+     *
+     * When enabled, the manager thread processes all axis events of a polling cycle with
+     * `GamepadAxisFilter`: the `value` of each posted `SDL_EVENT_GAMEPAD_AXIS_MOTION` event is
+     * replaced by the filtered value, and events that changed less than the hysteresis threshold
+     * are not posted at all. The stage runs after the axis coalescing. The gamepad state cache
+     * keeps the raw values.
+     *
+     * This method is thread-safe. The option is applied on the next polling cycle.
+     * @param newAxisFilterEnabled true to enable the axis filter.
+     */
+    void setAxisFilterEnabled(bool newAxisFilterEnabled);
+
+    /**
+     * @brief Returns the axis filter settings used for gamepads without their own settings.
+     */
+    GamepadAxisFilter::Settings axisFilterSettings() const;
+
+    /**
+     * @brief Sets the axis filter settings used for gamepads without their own settings.
+     *
+     * This method is thread-safe.
+     * @param newSettings The new settings.
+     */
+    void setAxisFilterSettings(const GamepadAxisFilter::Settings& newSettings);
+
+    /**
+     * @brief Sets the axis filter settings of one gamepad.
+     *
+     * This method is thread-safe.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param newSettings The new settings.
+     */
+    void setDeviceAxisFilterSettings(SDL_JoystickID device, const GamepadAxisFilter::Settings& newSettings);
+
+    /**
+     * @brief Removes the axis filter settings of one gamepad, so it uses `axisFilterSettings()` again.
+     *
+     * This method is thread-safe.
+     * @param device The SDL joystick instance id of the gamepad.
+     */
+    void resetDeviceAxisFilterSettings(SDL_JoystickID device);
+
+    /**
+     * @brief Checks whether the manager keeps the gamepad state cache up to date.
+     * @return true if the state cache is enabled. The default is false.
+     */
+    bool stateCacheEnabled() const;
+
+    /**
+     * @brief Enables or disables the gamepad state cache.
+     *
+     * When enabled, the manager thread applies each gamepad event to the `GamepadStateCache`
+     * and publishes the changes once per polling cycle.
+     * @param newStateCacheEnabled true to enable the state cache.
+     */
+    void setStateCacheEnabled(bool newStateCacheEnabled);
+
+    /**
+     * @brief Returns the cache of the current state of all opened gamepads.
+     *
+     * `GamepadStateCache::snapshot()` may be called from any thread without locks.
+     * @return A reference to the state cache owned by the manager.
+     * @see setStateCacheEnabled
+     */
+    const GamepadStateCache& stateCache() const;
+
+    /**
+     * @brief Requests the samples of a gamepad sensor.
+     *
+     * The manager never enables gamepad sensors by itself. A sensor is enabled with
+     * `SDL_SetGamepadSensorEnabled()` on the opened gamepads that have it and match @a devices while
+     * at least one request for it exists, including gamepads connected later, and is disabled again
+     * when its last request is released. Idle sensors cost no bandwidth and no event processing.
+     *
+     * When @a rate is below the rate reported by the gamepad, the samples of each period are averaged
+     * into one `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` event. The requests of one sensor share the samples,
+     * so the highest requested rate wins and a rate of 0 keeps the native rate.
+     *
+     * This method is thread-safe. The request is applied on the manager thread at the end of the next polling cycle.
+     * @param sensor The sensor type, for example `SDL_SENSOR_GYRO`.
+     * @param rate The delivery rate in Hz, or 0 for the native rate of the gamepad.
+     * @param devices The gamepads whose sensor is enabled.
+     * @return The id of the request for `releaseSensor()`.
+     */
+    int requestSensor(SDL_SensorType sensor, float rate = 0, const DeviceFilter& devices = {});
+
+    /**
+     * @brief Releases a sensor request. This method is thread-safe.
+     * @param id The id returned by `requestSensor()`.
+     */
+    void releaseSensor(int id);
+
+    /**
+     * @brief Checks whether gamepad sensor samples are delivered in blocks.
+     * @return true if the block delivery is enabled. The default is false.
+     */
+    bool sensorBlockDelivery() const;
+
+    /**
+     * @brief Enables or disables the block delivery of gamepad sensor samples.
+     *
+     * When enabled, `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` events are not wrapped into
+     * `QSDLGamepadSensorEvent`. Their samples are written into a per-device, per-sensor
+     * ring buffer (see `GamepadSensorBuffer`) and posted as one `QSDLGamepadSensorBlockEvent`
+     * per sensor every `sensorBlockInterval()` milliseconds.
+     * @param newSensorBlockDelivery true to enable the block delivery.
+     */
+    void setSensorBlockDelivery(bool newSensorBlockDelivery);
+
+    /**
+     * @brief Returns the interval (in milliseconds) between two sensor block notifications.
+     * @return The interval in milliseconds. The default is 4 ms.
+     */
+    int sensorBlockInterval() const;
+
+    /**
+     * @brief Sets the interval (in milliseconds) between two sensor block notifications.
+     *
+     * Use 0 to deliver the blocks on each polling cycle, or the display refresh period
+     * (for example 16 ms) to get one block per frame.
+     * @param newSensorBlockInterval The interval in milliseconds.
+     */
+    void setSensorBlockInterval(int newSensorBlockInterval);
+
+    /**
+     * @brief Returns the capacity of each sensor ring buffer in samples.
+     * @return The capacity of the buffers. The default is 256 samples.
+     */
+    int sensorBufferCapacity() const;
+
+    /**
+     * @brief Sets the capacity of each sensor ring buffer in samples.
+     *
+     * The new value is applied to the buffers created after this call.
+     * @param newSensorBufferCapacity The capacity in samples.
+     */
+    void setSensorBufferCapacity(int newSensorBufferCapacity);
+
+    /**
+     * @brief Checks whether the events of joysticks are delivered as compact state packets.
+     * @return true if the state delivery is enabled. The default is false.
+     */
+    bool joystickStateDelivery() const;
+
+    /**
+     * @brief Enables or disables the delivery of joystick state packets.
+     *
+     * The manager opens the joysticks that are not gamepads, such as flight sticks and racing wheels,
+     * while `JoystickEvents` are enabled. When the state delivery is enabled, the axis, button and hat
+     * events of these joysticks are folded into a `JoystickState`, which is posted as one
+     * `QSDLJoystickStateEvent` per `SDL_EVENT_JOYSTICK_UPDATE_COMPLETE` in which the joystick changed.
+     * The packet holds all buttons and hats, and only the changed axes. Joystick events of gamepads
+     * are delivered as usual.
+     * @param newJoystickStateDelivery true to enable the state delivery.
+     */
+    void setJoystickStateDelivery(bool newJoystickStateDelivery);
+
+    /**
+     * @brief Checks whether touchpad events are folded into finger trajectories.
+     * @return true if the touchpad tracking is enabled. The default is false.
+     */
+    bool touchpadTracking() const;
+
+    /**
+     * @brief Enables or disables the touchpad finger tracking.
+     *
+     * When enabled, `SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN`, `SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION` and
+     * `SDL_EVENT_GAMEPAD_TOUCHPAD_UP` events are not wrapped into `QSDLGamepadTouchpadEvent`.
+     * The manager thread keeps the state of each finger with `GamepadTouchpadTracker` and gathers
+     * the samples of a polling cycle into compact polylines with velocity estimates and touch and
+     * lift markers. They are delivered as one `QSDLGamepadTouchpadTrajectoryEvent` per gamepad and
+     * cycle to the `GamepadTouchpadTrajectory` subscribers, in all delivery modes. The gamepad state
+     * cache still receives every sample.
+     *
+     * The option is applied on the next polling cycle.
+     * @param newTouchpadTracking true to enable the touchpad tracking.
+     */
+    void setTouchpadTracking(bool newTouchpadTracking);
+
+    /**
+     * @brief Checks whether the gamepad sensors are fused into orientations.
+     * @return true if the orientation fusion is enabled. The default is false.
+     */
+    bool orientationFusion() const;
+
+    /**
+     * @brief Enables or disables the orientation fusion.
+     *
+     * When enabled, the manager requests the gyroscope and the accelerometer of all gamepads that
+     * have them (see `requestSensor()`), and their `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` samples are fused
+     * into one quaternion per gamepad by `GamepadOrientationFilter` on the manager thread. The samples
+     * are consumed, so they are neither wrapped into `QSDLGamepadSensorEvent` nor written into sensor
+     * blocks. The orientation of each gamepad that moved is delivered as a `QSDLGamepadOrientationEvent`
+     * to the `GamepadOrientation` subscribers at most `orientationRate()` times per second, in all
+     * delivery modes. Disabling the fusion releases the sensors and forgets the orientations.
+     *
+     * This method is thread-safe. The option is applied on the next polling cycle.
+     * @param newOrientationFusion true to enable the orientation fusion.
+     */
+    void setOrientationFusion(bool newOrientationFusion);
+
+    /**
+     * @brief Returns the rate (in Hz) at which fused orientations are published.
+     * @return The rate in Hz. The default is 60 Hz.
+     */
+    float orientationRate() const;
+
+    /**
+     * @brief Sets the rate (in Hz) at which fused orientations are published.
+     *
+     * Use the display refresh rate to get one orientation per gamepad and frame, or 0 to publish
+     * on each polling cycle. The samples are fused as they arrive regardless of the rate.
+     * This method is thread-safe.
+     * @param newOrientationRate The rate in Hz.
+     */
+    void setOrientationRate(float newOrientationRate);
+
+    /**
+     * @brief Returns the settings of the orientation fusion.
+     */
+    GamepadOrientationFilter::Settings orientationSettings() const;
+
+    /**
+     * @brief Sets the settings of the orientation fusion, such as the filter gains and the rest detection.
+     *
+     * This method is thread-safe. The settings are applied on the next polling cycle and keep the current orientations.
+     * @param newOrientationSettings The new settings.
+     */
+    void setOrientationSettings(const GamepadOrientationFilter::Settings& newOrientationSettings);
+
+    /**
+     * @brief Checks whether the manager evaluates the action maps.
+     * @return true if the action mapping is enabled. The default is false.
+     */
+    bool actionMappingEnabled() const;
+
+    /**
+     * @brief Enables or disables the evaluation of the action maps on the manager thread.
+     *
+     * When enabled, the button and axis events of each gamepad are applied to its compiled
+     * `GamepadActionMap` (see `GamepadActionMapper`) at the end of each polling cycle, and a
+     * `QSDLActionEvent` is delivered to the `GamepadAction` subscribers only when an action becomes
+     * active or is released. Unless the map sets `GamepadActionMap::forwardInput`, the raw events of
+     * the buttons and axes bound to an action are consumed, so they reach neither the receivers nor
+     * the handlers. The events of unbound buttons and axes are delivered as usual. Thresholds apply
+     * to the axis values after the axis filter, so its deadzone and curve are respected.
+     * Action events are delivered in all delivery modes. Disabling the mapping releases the active actions.
+     *
+     * This method is thread-safe. The option is applied on the next polling cycle.
+     * @param newActionMappingEnabled true to enable the action mapping.
+     */
+    void setActionMappingEnabled(bool newActionMappingEnabled);
+
+    /**
+     * @brief Returns the action map used for gamepads without their own map.
+     */
+    GamepadActionMap actionMap() const;
+
+    /**
+     * @brief Sets the action map used for gamepads without their own map.
+     *
+     * The map may be changed while the manager runs. It is compiled on the manager thread on the next
+     * polling cycle, and the actions whose state differs under the new map produce transitions.
+     * This method is thread-safe.
+     * @param newActionMap The new map.
+     */
+    void setActionMap(const GamepadActionMap& newActionMap);
+
+    /**
+     * @brief Sets the action map of one gamepad, for example to apply the remapping of one player.
+     *
+     * This method is thread-safe.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @param newActionMap The new map.
+     */
+    void setDeviceActionMap(SDL_JoystickID device, const GamepadActionMap& newActionMap);
+
+    /**
+     * @brief Removes the action map of one gamepad, so it uses `actionMap()` again.
+     *
+     * This method is thread-safe.
+     * @param device The SDL joystick instance id of the gamepad.
+     */
+    void resetDeviceActionMap(SDL_JoystickID device);
+
+    /**
+     * @brief Attaches a recorder that receives the input events drained by the manager.
+     *
+     * On the next polling cycle the manager writes the descriptions of the opened gamepads and then
+     * streams each drained joystick, gamepad and sensor event, including the descriptions of newly
+     * connected gamepads. Other events are not recorded, see `InputRecorder::isRecordable()`.
+     * Encoding happens on the manager thread, and file writes happen on the writer thread of the recorder.
+     *
+     * This method is thread-safe. When it returns, the manager does not use the previous recorder anymore,
+     * so it can be closed or destroyed.
+     * @param recorder The opened recorder, or nullptr to stop recording. The ownership is not transferred.
+     */
+    void setRecorder(InputRecorder* recorder);
+
+    /**
+     * @brief Replays a recording written by `InputRecorder`.
+     *
+     * The recorded events are passed through the same processing and delivery path as live input:
+     * filters, coalescing, state cache, subscriptions and delivery modes. Recorded gamepads are
+     * registered without opening real devices, and they are disconnected when the replay ends.
+     * Their `deviceInfo()` and the device bindings use the name, GUID, vendor and product stored
+     * in the recording.
+     * The timestamps of the replayed events are rebased to the current SDL time.
+     *
+     * This method is thread-safe. A running replay is replaced.
+     * @param path The path of the recording.
+     * @param speed The replay speed: 1 is real time, 2 is twice as fast, and 0 replays as fast as possible.
+     * @return true if the recording was opened.
+     * @see replayFinished
+     */
+    bool startReplay(const QString& path, double speed = 1.0);
+
+    /**
+     * @brief Stops the running replay. The gamepads of the recording are disconnected.
+     */
+    void stopReplay();
+
+    /**
+     * @brief Checks whether a recording is being replayed.
+     */
+    bool isReplaying() const;
+
+    /**
+     * @brief Checks whether latency and throughput metrics are collected.
+     */
+    bool metricsEnabled() const;
+
+    /**
+     * @brief Enables or disables the collection of latency and throughput metrics.
+     *
+     * While enabled, the manager records the poll-to-post latency, the events per cycle and the
+     * per-type counts of delivered events, and each posted `QSDLEvent` or `QSDLEventBatch` records
+     * its post-to-delivery latency when it is released after delivery. All counters are lock-free.
+     * Sensor blocks are not measured. Disabled by default.
+     * @param newMetricsEnabled true to collect metrics.
+     */
+    void setMetricsEnabled(bool newMetricsEnabled);
+
+    /**
+     * @brief Returns the interval of the `metricsUpdated()` signal in milliseconds.
+     */
+    int metricsInterval() const;
+
+    /**
+     * @brief Sets the interval of the `metricsUpdated()` signal.
+     * @param newMetricsInterval The interval in milliseconds, or 0 to disable the signal (default).
+     */
+    void setMetricsInterval(int newMetricsInterval);
+
+    /**
+     * @brief Returns a snapshot of the collected metrics. This method is thread-safe.
+     */
+    SDLEventMetricsSnapshot metrics() const;
+
+    /**
+     * @brief Resets the collected metrics.
+     */
+    void resetMetrics();
+
+    /**
+     * @brief Returns the description of an opened gamepad. This method is thread-safe.
+     *
+     * The description is captured once when the gamepad is added, so reading it never calls into SDL.
+     * A removed gamepad stays available until the end of the cycle that delivers its removal.
+     * @param device The instance ID of the gamepad.
+     * @return The description, or nullptr if the gamepad is not opened.
+     */
+    std::shared_ptr<const DeviceInfo> deviceInfo(SDL_JoystickID device) const;
+
+    /**
+     * @brief Returns the description of the gamepad in a slot. This method is thread-safe.
+     * @param slot The slot, for example from `QSDLEvent::deviceSlot()`.
+     * @return The description, or nullptr if the slot is free or belongs to another generation.
+     */
+    std::shared_ptr<const DeviceInfo> deviceInfo(DeviceSlot slot) const;
+
+    /**
+     * @brief Returns the descriptions of all opened gamepads. This method is thread-safe.
+     */
+    QList<std::shared_ptr<const DeviceInfo>> devices() const;
+
+    /**
+     * @brief Starts a rumble effect on a gamepad.
+     *
+     * The output methods never wait for the HID write: they push a command into a single-producer
+     * `SPSCQueue`, and the manager thread sends it on its next cycle. Commands of the same device and
+     * effect queued during one cycle are coalesced, so only the latest state is sent.
+     *
+     * The producer side of the queue is guarded by a mutex, so the output methods may be called from
+     * several threads, but concurrent calls contend on that mutex and wait for each other. The manager
+     * thread never takes the mutex and drains the queue without blocking.
+     * @param device The instance ID of the gamepad.
+     * @param lowFrequency The intensity of the low frequency (left) rumble motor, from 0 to 0xFFFF.
+     * @param highFrequency The intensity of the high frequency (right) rumble motor, from 0 to 0xFFFF.
+     * @param duration The duration of the effect in milliseconds. Zero intensities stop the effect.
+     * @return false if the queue is full and the command was dropped.
+     */
+    bool rumble(SDL_JoystickID device, Uint16 lowFrequency, Uint16 highFrequency, Uint32 duration);
+
+    /**
+     * @brief Starts a rumble effect in the triggers of a gamepad. See `rumble()` for the delivery rules.
+     * @param device The instance ID of the gamepad.
+     * @param left The intensity of the left trigger motor, from 0 to 0xFFFF.
+     * @param right The intensity of the right trigger motor, from 0 to 0xFFFF.
+     * @param duration The duration of the effect in milliseconds.
+     * @return false if the queue is full and the command was dropped.
+     */
+    bool rumbleTriggers(SDL_JoystickID device, Uint16 left, Uint16 right, Uint32 duration);
+
+    /**
+     * @brief Sets the color of the LED of a gamepad. See `rumble()` for the delivery rules.
+     * @param device The instance ID of the gamepad.
+     * @param red The red component.
+     * @param green The green component.
+     * @param blue The blue component.
+     * @return false if the queue is full and the command was dropped.
+     */
+    bool setLED(SDL_JoystickID device, Uint8 red, Uint8 green, Uint8 blue);
+
+    /**
+     * @brief Returns the number of output commands dropped because the queue was full.
+     */
+    quint64 droppedOutputCommands() const;
+
+signals:
+    /**
+     * @brief Emitted from the manager thread when a replay reaches the end of the recording.
+     */
+    void replayFinished();
+
+    /**
+     * @brief Emitted from the manager thread every `metricsInterval()` milliseconds while metrics are enabled.
+     * @param metrics The snapshot of the collected metrics.
+     */
+    void metricsUpdated(const QtSDL::SDLEventMetricsSnapshot& metrics);
+
+protected:
+    /**
+     * @brief The main entry point for the event manager thread.
+     *
+     * Continuously polls for SDL events and posts them to Qt's event queue.
+     * Handles gamepad device lifecycle. In the inline mode it only queues `startInline()`
+     * to the thread the manager lives in.
+     */
+    void run() override;
+
+private:
+    /**
+     * @brief The AxisMerge struct describes the axis samples collapsed into one event during a cycle.
+     */
+    struct AxisMerge {
+        /// The position of the latest sample in the cycle.
+        qsizetype index;
+        /// The number of merged samples.
+        quint32 samples;
+        /// The timestamp of the first merged sample.
+        Uint64 firstTimestamp;
+    };
+
+    /**
+     * @brief The Subscription struct describes the events requested by one receiver.
+     */
+    struct Subscription {
+        QObject* receiver = nullptr;
+        EventMask types;
+        DeviceFilter devices;
+        QMetaObject::Connection destroyedConnection;
+    };
+
+    /**
+     * @brief The Handler struct describes a handler added with `addEventHandler()`.
+     */
+    struct Handler {
+        int id = 0;
+        EventMask types;
+        EventHandler callback;
+    };
+
+    /**
+     * @brief The SensorRequest struct describes a request added with `requestSensor()`.
+     */
+    struct SensorRequest {
+        int id = 0;
+        SDL_SensorType sensor = SDL_SENSOR_INVALID;
+        float rate = 0;
+        DeviceFilter devices;
+    };
+
+    /**
+     * @brief The SensorDecimator struct is an enabled sensor of a gamepad and the state of its rate reduction.
+     */
+    struct SensorDecimator {
+        /// The requested rate in Hz, or 0 for the native rate.
+        float rate = 0;
+        /// The delivery period in nanoseconds, or 0 if every sample is delivered.
+        Uint64 period = 0;
+        /// The sensor time at which the current period ends, or 0 before the first sample.
+        Uint64 deadline = 0;
+        /// The sum of the samples of the current period.
+        std::array<double, 3> sum {};
+        /// The number of samples of the current period.
+        quint32 samples = 0;
+    };
+
+    /**
+     * @brief The Binding struct binds a gamepad or a player slot to a target.
+     */
+    struct Binding {
+        DeviceBinding key;
+        QObject* target = nullptr;
+        QMetaObject::Connection destroyedConnection;
+    };
+
+    /**
+     * @brief The Route struct is an entry of the compiled routing table.
+     */
+    struct Route {
+        QObject* receiver;
+        const DeviceFilter* devices;
+    };
+
+    /**
+     * @brief The number of bits used by `EventTypeFlag`.
+     */
+    static constexpr int EVENT_TYPE_FLAGS_COUNT = 15;
+
+    /**
+     * @brief Processes a single SDL event and appends it to the events of the current cycle.
+     *
+     * Also opens and closes gamepads on device connection and disconnection events.
+     * @param event The SDL event to process.
+     */
+    void processEvent(const SDL_Event& event);
+
+    /**
+     * @brief Passes a processed event through the state cache and the delivery stages, and appends it to the current cycle.
+     * @param event The SDL event.
+     */
+    void appendEvent(const SDL_Event& event);
+
+    /**
+     * @brief Averages a gamepad sensor sample down to the rate requested for its sensor.
+     * @param event The `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` event. It is replaced with the average when a period ends.
+     * @return true if the event must be delivered.
+     */
+    bool decimateSensorEvent(SDL_Event& event);
+
+    /**
+     * @brief Enables and disables the gamepad sensors on the manager thread to match the sensor requests.
+     */
+    void syncSensors();
+
+    /**
+     * @brief Appends an axis motion event to the current cycle, replacing the previous sample of the same axis.
+     * @param event The `SDL_EVENT_GAMEPAD_AXIS_MOTION` event.
+     */
+    void coalesceAxisEvent(const SDL_Event& event);
+
+    /**
+     * @brief Applies the state cache option on the manager thread, adding or removing the opened gamepads.
+     */
+    void syncStateCache();
+
+    /**
+     * @brief Finds the target bound to a connected gamepad.
+     * @param device The SDL joystick instance id.
+     * @return The bound target, or nullptr.
+     */
+    QObject* resolveBinding(SDL_JoystickID device) const;
+
+    /**
+     * @brief Forgets the targets of the gamepads disconnected during the current cycle.
+     */
+    void releaseBindings();
+
+    /**
+     * @brief Calls the handlers for the events of the current cycle.
+     */
+    void invokeHandlers();
+
+    /**
+     * @brief Posts the events of bound gamepads to their targets and removes them from the current cycle.
+     */
+    void deliverBoundBatches();
+
+    /**
+     * @brief Applies the event categories, the device allowlist and the axis filter options
+     * on the manager thread if they were changed.
+     */
+    void syncEventFilters();
+
+    /**
+     * @brief Enables or disables the SDL event types of the categories with `SDL_SetEventEnabled()`.
+     * @param categories The categories to change.
+     * @param enabled true to enable the event types.
+     */
+    void setCategoriesEnabled(EventCategories categories, bool enabled);
+
+    /**
+     * @brief Enables or disables the user event types remembered by `QSDLEventFactory`.
+     * @param enabled true to enable the event types.
+     */
+    void setUserEventsEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether the event belongs to a gamepad rejected by the device allowlist.
+     *
+     * Forgets the gamepad when the event is its `SDL_EVENT_GAMEPAD_REMOVED` event.
+     * @param event The SDL event.
+     * @return true if the event must be dropped.
+     */
+    bool dropIgnoredDeviceEvent(const SDL_Event& event);
+
+    /**
+     * @brief Builds a synthetic gamepad device event.
+     * @param type The `SDL_EVENT_GAMEPAD_ADDED` or `SDL_EVENT_GAMEPAD_REMOVED` type.
+     * @param device The SDL joystick instance id of the gamepad.
+     * @return The event.
+     */
+    static SDL_Event gamepadDeviceEvent(Uint32 type, SDL_JoystickID device);
+
+    /**
+     * @brief Posts the events of the current cycle as batches, one per subscribed receiver.
+     * @param appInstance The application instance that receives the batch when there are no subscribers.
+     * @return The number of events that were not posted to any receiver. It is counted only when the metrics are enabled.
+     */
+    quint64 deliverBatch(QCoreApplication* appInstance);
+
+    /**
+     * @brief Creates a batch of the current cycle with the device slots and the merged axis samples.
+     * @param events The events of the batch.
+     * @return A new batch. The ownership is passed to the caller.
+     */
+    QSDLEventBatch* createBatch(QList<SDL_Event> events);
+
+    /**
+     * @brief Posts an event to all receivers subscribed to its type and device.
+     *
+     * Must be called with `m_routesMutex` locked.
+     * @param appInstance The application instance that receives the event when there are no subscribers.
+     * @param type The group of the event.
+     * @param device The SDL joystick instance id of the event, or 0.
+     * @param create A callable that allocates a new event object for each receiver.
+     * @return true if the event was posted to at least one receiver.
+     */
+    template<class Factory>
+    bool route(QCoreApplication* appInstance, EventTypeFlag type, SDL_JoystickID device, const Factory& create);
+
+    /**
+     * @brief Rebuilds the routing table from the subscriptions if they were changed.
+     *
+     * Must be called on the manager thread with `m_routesMutex` locked.
+     */
+    void updateRoutes();
+
+    /**
+     * @brief Returns the subscription group of an SDL event type.
+     * @param type The SDL event type.
+     * @return The group of the event.
+     */
+    static EventTypeFlag eventTypeFlag(Uint32 type);
+
+    /**
+     * @brief Writes a gamepad sensor sample into the ring buffer of its device and sensor.
+     * @param event The `SDL_EVENT_GAMEPAD_SENSOR_UPDATE` event.
+     */
+    void bufferSensorEvent(const SDL_GamepadSensorEvent& event);
+
+    /**
+     * @brief Posts the buffered sensor samples as `QSDLGamepadSensorBlockEvent`s when the block interval expires.
+     * @param appInstance The application instance that receives the events.
+     */
+    void deliverSensorBlocks(QCoreApplication* appInstance);
+
+    /**
+     * @brief Posts the buffered sensor samples of a gamepad at once and drops its buffers.
+     *
+     * Called before the removal of the gamepad is delivered, so its last samples are not posted after it.
+     * @param device The SDL joystick instance id of the gamepad.
+     */
+    void flushSensorBlocks(SDL_JoystickID device);
+
+    /**
+     * @brief Posts the samples of a sensor ring buffer as one `QSDLGamepadSensorBlockEvent`.
+     *
+     * Must be called on the manager thread with `m_routesMutex` locked.
+     * @param appInstance The application instance that receives the events.
+     * @param key The device and sensor key of the buffer.
+     * @param buffer The buffer.
+     */
+    void postSensorBlock(QCoreApplication* appInstance, quint64 key, GamepadSensorBuffer& buffer);
+
+    /**
+     * @brief Returns how long the thread may wait before it must deliver pending data.
+     * @return The timeout in milliseconds, or -1 if nothing is pending.
+     */
+    int pendingTimeout() const;
+
+    /**
+     * @brief Returns the wait timeout until a deadline, rounded up to whole milliseconds.
+     * @param now The current SDL time in nanoseconds.
+     * @param deadline The SDL time of the deadline in nanoseconds.
+     * @return The timeout in milliseconds, 0 only if the deadline has passed.
+     */
+    static int timeoutUntil(Uint64 now, Uint64 deadline);
+
+    /**
+     * @brief Returns the key of the gamepad axis used by the coalescing stage.
+     * @param event The axis motion event.
+     * @return A key unique for each pair of gamepad and axis.
+     */
+    static quint64 axisKey(const SDL_GamepadAxisEvent& event);
+
+    /**
+     * @brief Wraps a single SDL event into its QSDLEvent class.
+     * @param event The SDL event to wrap.
+     * @return A new event object. The ownership is passed to the caller.
+     */
+    QSDLEvent* wrapEvent(const SDL_Event& event);
+
+    /**
+     * @brief Records the poll-to-post latency and the type of a posted SDL event when the metrics are enabled.
+     * @param event The posted SDL event.
+     */
+    void recordPosted(const SDL_Event& event);
+
+    /**
+     * @brief Posts the events collected during the current cycle according to the delivery mode.
+     * @param appInstance The application instance that receives the events.
+     */
+    void deliverCycle(QCoreApplication* appInstance);
+
+    /**
+     * @brief Blocks until the next SDL event is available according to the current wait mode.
+     * @param event The structure that receives the next event.
+     * @param timeout The current timeout of the adaptive mode in milliseconds.
+     * @return true if an event was received.
+     */
+    bool waitEvent(SDL_Event* event, int timeout);
+
+    /**
+     * @brief Pushes the internal wake-up event into the SDL queue.
+     */
+    void wakeUp();
+
+    /**
+     * @brief Prepares the post timestamp and the metrics of the current cycle.
+     */
+    void measureCycle();
+
+    /**
+     * @brief Emits `metricsUpdated()` when the metrics interval has elapsed.
+     */
+    void reportMetrics();
+
+    /**
+     * @brief Writes the events drained during the current cycle to the attached recorder.
+     */
+    void recordCycle();
+
+    /**
+     * @brief Starts or stops the replay requested by `startReplay()` or `stopReplay()`.
+     */
+    void syncReplay();
+
+    /**
+     * @brief Processes the replayed events that are due.
+     * @return true if at least one event was processed.
+     */
+    bool replayEvents();
+
+    /**
+     * @brief Processes an event of the replay, registering or unregistering the replayed gamepads.
+     * @param event The replayed event.
+     */
+    void processReplayedEvent(const SDL_Event& event);
+
+    /**
+     * @brief Returns the SDL time at which a replayed event is due.
+     * @param timestamp The recorded timestamp of the event.
+     * @return The rebased timestamp in nanoseconds.
+     */
+    Uint64 replayDueTime(Uint64 timestamp) const;
+
+    /**
+     * @brief Ends the current replay and disconnects the replayed gamepads.
+     */
+    void finishReplay();
+
+    /**
+     * @brief The OutputCommand struct is a haptic or LED command queued by the output methods.
+     */
+    struct OutputCommand {
+        /// The effect of the command.
+        enum Effect: Uint8 {
+            Rumble,
+            TriggerRumble,
+            LED
+        };
+
+        SDL_JoystickID device = 0;
+        Effect effect = Rumble;
+        /// The motor intensities of the rumble effects, or the red and green components of the LED.
+        Uint16 first = 0;
+        /// The second motor intensity, or the blue component of the LED.
+        Uint16 second = 0;
+        /// The duration of the rumble effects in milliseconds.
+        Uint32 duration = 0;
+    };
+
+    /**
+     * @brief The JoystickAccumulator struct collects the events of a joystick between two update completions.
+     */
+    struct JoystickAccumulator {
+        /// The buttons and hats, the changed axes are filled when the packet is closed.
+        QtSDL::JoystickState state;
+        /// The current values of the axes.
+        std::array<Sint16, QtSDL::JoystickState::MAX_AXES> axes {};
+        /// The bitmask of the axes changed since the previous packet.
+        quint64 changedAxes = 0;
+        /// Set when the state changed since the previous packet.
+        bool dirty = false;
+    };
+
+    /**
+     * @brief Closes a joystick that is not a gamepad.
+     * @param device The SDL joystick instance id of the joystick.
+     */
+    void closeJoystick(SDL_JoystickID device);
+
+    /**
+     * @brief Folds a joystick event into the state of its joystick.
+     * @param event The joystick event.
+     * @return true if the event was folded and must not be delivered.
+     */
+    bool foldJoystickEvent(const SDL_Event& event);
+
+    /**
+     * @brief Closes the current state packet of a joystick.
+     * @param device The SDL joystick instance id of the joystick.
+     * @param accumulator The state of the joystick.
+     * @param timestamp The SDL timestamp of the update completion.
+     */
+    void closeJoystickState(SDL_JoystickID device, JoystickAccumulator& accumulator, Uint64 timestamp);
+
+    /**
+     * @brief Posts the joystick state packets closed in the current cycle.
+     * @param appInstance The application instance.
+     */
+    void deliverJoystickStates(QCoreApplication* appInstance);
+
+    /**
+     * @brief Applies the joystick state delivery option on the manager thread.
+     */
+    void syncJoystickStates();
+
+    /**
+     * @brief Compiles the action maps on the manager thread and applies the action mapping option if they were changed.
+     */
+    void syncActionMaps();
+
+    /**
+     * @brief Applies the gamepad events of the current cycle to the action mapper and marks the consumed events as dead.
+     *
+     * It runs after the axis filter, so the thresholds apply to the filtered axis values.
+     */
+    void mapActions();
+
+    /**
+     * @brief Posts the action transitions of the current cycle.
+     * @param appInstance The application instance.
+     */
+    void deliverActions(QCoreApplication* appInstance);
+
+    /**
+     * @brief Applies the touchpad tracking option on the manager thread.
+     */
+    void syncTouchpadTracking();
+
+    /**
+     * @brief Posts the touchpad trajectories of the current cycle, one event per gamepad.
+     * @param appInstance The application instance.
+     */
+    void deliverTouchpadTrajectories(QCoreApplication* appInstance);
+
+    /**
+     * @brief Applies the orientation fusion options on the manager thread.
+     */
+    void syncOrientationFusion();
+
+    /**
+     * @brief Fuses the sensor samples of the current cycle and posts the orientations when the publish period elapsed.
+     * @param appInstance The application instance.
+     */
+    void deliverOrientations(QCoreApplication* appInstance);
+
+    /**
+     * @brief Publishes the descriptions of the opened devices for other threads.
+     */
+    void publishDevices();
+
+    /**
+     * @brief Frees the slots of the gamepads removed in the current cycle.
+     */
+    void releaseDevices();
+
+    /**
+     * @brief Queues an output command and wakes the manager thread.
+     * @param command The command.
+     * @return false if the queue is full.
+     */
+    bool queueOutput(const OutputCommand& command);
+
+    /**
+     * @brief Drains the output queue, coalesces the commands and sends them to the gamepads.
+     */
+    void executeOutput();
+
+    /**
+     * @brief Drains, processes and delivers one polling cycle.
+     * @param appInstance The application instance.
+     * @param timeout The timeout of the adaptive wait mode in milliseconds.
+     * @return true if at least one event was processed.
+     */
+    bool processCycle(QCoreApplication* appInstance, int timeout);
+
+    /**
+     * @brief Posts an event, or queues it for `sendEvent()` in the inline mode when the receiver lives in this thread.
+     * @param receiver The receiver of the event.
+     * @param event The event. The ownership is transferred.
+     */
+    void dispatchEvent(QObject* receiver, QEvent* event);
+
+    /**
+     * @brief Sends the events queued by `dispatchEvent()`. It runs after the routing lock is released,
+     * so receivers can subscribe, unsubscribe or destroy objects while they handle the events.
+     */
+    void flushSentEvents();
+
+    /**
+     * @brief Runs one inline polling cycle and schedules the next one.
+     */
+    void pumpInline();
+
+    /**
+     * @brief Schedules an inline polling cycle as soon as possible. This method is thread-safe.
+     */
+    void scheduleInlinePump();
+
+    /**
+     * @brief Stops the inline pump.
+     */
+    void stopInline();
+
+    /**
+     * @brief The SDL event watch of the inline mode. It wakes the pump when another thread pushes an event.
+     */
+    static bool SDLCALL inlineEventWatch(void* userdata, SDL_Event* event);
+
+    /**
+     * @brief The connected joysticks rejected by the device allowlist.
+     */
+    QSet<SDL_JoystickID> m_ignoredJoysticks;
+
+    /**
+     * @brief Enables the delivery of joystick state packets.
+     */
+    std::atomic<bool> m_joystickStateDelivery {false};
+
+    /**
+     * @brief The joystick state delivery option applied on the manager thread.
+     */
+    bool m_joystickStatesActive = false;
+
+    /**
+     * @brief The states of the opened joysticks while the state delivery is enabled.
+     */
+    QHash<SDL_JoystickID, JoystickAccumulator> m_joystickStates;
+
+    /**
+     * @brief The joystick state packets closed in the current cycle.
+     */
+    QList<QtSDL::JoystickState> m_joystickPackets;
+
+    /**
+     * @brief Enables the touchpad finger tracking.
+     */
+    std::atomic<bool> m_touchpadTracking {false};
+
+    /**
+     * @brief The touchpad tracking option applied on the manager thread.
+     */
+    bool m_touchpadTrackingActive = false;
+
+    /**
+     * @brief The fingers and the trajectories of the current cycle.
+     */
+    GamepadTouchpadTracker m_touchpadTracker;
+
+    /**
+     * @brief Protects the orientation fusion options requested by the user.
+     */
+    mutable QMutex m_orientationMutex;
+
+    /**
+     * @brief The orientation fusion option requested by the user.
+     */
+    bool m_orientationFusion = false;
+
+    /**
+     * @brief The publish rate of the orientations in Hz.
+     */
+    float m_orientationRate = 60;
+
+    /**
+     * @brief The orientation fusion settings requested by the user.
+     */
+    GamepadOrientationFilter::Settings m_orientationSettings;
+
+    /**
+     * @brief The ids of the gyroscope and accelerometer requests of the orientation fusion.
+     */
+    std::array<int, 2> m_orientationSensorRequests {};
+
+    /**
+     * @brief Set when the options protected by `m_orientationMutex` were changed.
+     */
+    std::atomic<bool> m_orientationDirty {false};
+
+    /**
+     * @brief The orientation fusion option applied on the manager thread.
+     */
+    bool m_orientationFusionActive = false;
+
+    /**
+     * @brief The publish period applied on the manager thread in nanoseconds.
+     */
+    Uint64 m_orientationPeriod = 0;
+
+    /**
+     * @brief The SDL time (in nanoseconds) of the last orientation publish.
+     */
+    Uint64 m_lastOrientationPublish = 0;
+
+    /**
+     * @brief The orientations of the gamepads.
+     */
+    GamepadOrientationFilter m_orientationFilter;
+
+    /**
+     * @brief Protects the action maps and the action mapping option requested by the user.
+     */
+    mutable QMutex m_actionsMutex;
+
+    /**
+     * @brief The action mapping option requested by the user.
+     */
+    bool m_actionMappingEnabled = false;
+
+    /**
+     * @brief The default action map requested by the user.
+     */
+    GamepadActionMap m_actionMap;
+
+    /**
+     * @brief The per-device action maps requested by the user.
+     */
+    QHash<SDL_JoystickID, GamepadActionMap> m_deviceActionMaps;
+
+    /**
+     * @brief Set when the options protected by `m_actionsMutex` were changed.
+     */
+    std::atomic<bool> m_actionMapsDirty {false};
+
+    /**
+     * @brief The action mapping option applied on the manager thread.
+     */
+    bool m_actionMappingActive = false;
+
+    /**
+     * @brief The compiled action maps and the actions of the opened gamepads.
+     */
+    GamepadActionMapper m_actionMapper;
+
+    /**
+     * @brief The action transitions of the current cycle.
+     */
+    QList<GamepadActionMapper::Transition> m_actionTransitions;
+
+    /**
+     * @brief The haptic and LED commands waiting for the manager thread.
+     */
+    SPSCQueue<OutputCommand> m_output {256};
+
+    /**
+     * @brief Serializes the threads that queue output commands. The manager thread never takes it.
+     */
+    QMutex m_outputMutex;
+
+    /**
+     * @brief Set while a wake-up for queued output commands is pending.
+     */
+    std::atomic<bool> m_outputWakePending {false};
+
+    /**
+     * @brief The output commands of the current cycle, coalesced by device and effect.
+     */
+    QHash<quint64, OutputCommand> m_pendingOutput;
+
+    /**
+     * @brief The threading mode chosen at construction.
+     */
+    const ThreadingMode m_threadingMode = ThreadingMode::Threaded;
+
+    /**
+     * @brief The timer of the inline pump, created in the inline mode only.
+     */
+    QTimer* m_inlineTimer = nullptr;
+
+    /**
+     * @brief The current interval of the inline pump in milliseconds.
+     */
+    int m_inlineInterval = 1;
+
+    /**
+     * @brief Set while the inline pump is running.
+     */
+    bool m_inlineActive = false;
+
+    /**
+     * @brief Set while a wake-up of the inline pump is queued.
+     */
+    std::atomic<bool> m_inlineWakePending {false};
+
+    /**
+     * @brief The event sent to a receiver of the inline mode.
+     */
+    struct SentEvent {
+        QPointer<QObject> receiver;
+        QEvent* event;
+    };
+
+    /**
+     * @brief The events waiting for `flushSentEvents()`.
+     */
+    QList<SentEvent> m_sentEvents;
+
+    /**
+     * @brief Flag to control the execution loop of the thread.
+     */
+    volatile bool m_quitFlag = false;
+
+    /**
+     * @brief true while `start()` waits for an asynchronous initialization.
+     */
+    std::atomic<bool> m_startPending = false;
+
+    /**
+     * @brief The delay in milliseconds applied after each SDL event polling cycle.
+     */
+    int m_eventDelay = 10;
+
+    /**
+     * @brief The strategy used to wait for new SDL events.
+     */
+    std::atomic<WaitMode> m_waitMode {WaitMode::Poll};
+
+    /**
+     * @brief The SDL event type registered for internal wake-up events. 0 if registration failed.
+     */
+    Uint32 m_wakeEventType = 0;
+
+    /**
+     * @brief How drained SDL events are posted to the application.
+     */
+    std::atomic<DeliveryMode> m_deliveryMode {DeliveryMode::PerEvent};
+
+    /**
+     * @brief Enables the coalescing of axis motion events.
+     */
+    std::atomic<bool> m_axisCoalescing {false};
+
+    /**
+     * @brief The events collected during the current polling cycle.
+     */
+    QList<SDL_Event> m_cycle;
+
+    /**
+     * @brief The axis samples merged during the current cycle, keyed by `axisKey()`.
+     */
+    QHash<quint64, AxisMerge> m_axisMerges;
+
+    /**
+     * @brief The merged axis samples attached to the batches of the current cycle.
+     */
+    QHash<quint64, QSDLEventBatch::AxisSamples> m_batchAxisSamples;
+
+    /**
+     * @brief Set when the current cycle contains events superseded by the coalescing stage.
+     */
+    bool m_hasDeadEvents = false;
+
+    /**
+     * @brief Protects the subscriptions. It is held by the manager thread while events are posted,
+     * so a receiver can not be destroyed in the middle of a delivery.
+     */
+    QMutex m_routesMutex;
+
+    /**
+     * @brief The subscriptions changed by `subscribe()` and `unsubscribe()`.
+     */
+    QList<Subscription> m_subscriptions;
+
+    /**
+     * @brief Set when the subscriptions were changed and the routing table must be rebuilt.
+     */
+    bool m_routesDirty = false;
+
+    /**
+     * @brief The copy of the subscriptions used by the routing table of the manager thread.
+     */
+    QList<Subscription> m_routeList;
+
+    /**
+     * @brief The routing table: the receivers of each `EventTypeFlag` bit.
+     */
+    std::array<QList<Route>, EVENT_TYPE_FLAGS_COUNT> m_routes;
+
+    /**
+     * @brief Set when there is at least one subscriber and events are not posted to the application.
+     */
+    bool m_routingActive = false;
+
+    /**
+     * @brief The handlers changed by `addEventHandler()` and `removeEventHandler()`. Protected by `m_routesMutex`.
+     */
+    QList<Handler> m_handlers;
+
+    /**
+     * @brief The copy of the handlers used by the manager thread.
+     */
+    QList<Handler> m_handlerList;
+
+    /**
+     * @brief The id of the next handler.
+     */
+    int m_nextHandlerId = 1;
+
+    /**
+     * @brief The bindings changed by `bindDevice()` and `unbindDevice()`. Protected by `m_routesMutex`.
+     */
+    QList<Binding> m_bindings;
+
+    /**
+     * @brief The copy of the bindings used by the manager thread.
+     */
+    QList<Binding> m_bindingList;
+
+    /**
+     * @brief The targets of the connected bound gamepads.
+     */
+    QHash<SDL_JoystickID, QObject*> m_boundDevices;
+
+    /**
+     * @brief The bound gamepads disconnected during the current cycle. They are released after delivery.
+     */
+    QList<SDL_JoystickID> m_releasedBindings;
+
+    /**
+     * @brief The state cache option requested by the user.
+     */
+    std::atomic<bool> m_stateCacheEnabled {false};
+
+    /**
+     * @brief The state cache option applied on the manager thread.
+     */
+    bool m_stateCacheActive = false;
+
+    /**
+     * @brief The current state of all opened gamepads.
+     */
+    GamepadStateCache m_stateCache;
+
+    /**
+     * @brief Enables the block delivery of gamepad sensor samples.
+     */
+    std::atomic<bool> m_sensorBlockDelivery {false};
+
+    /**
+     * @brief The interval in milliseconds between two sensor block notifications.
+     */
+    std::atomic<int> m_sensorBlockInterval {4};
+
+    /**
+     * @brief The capacity of new sensor ring buffers in samples.
+     */
+    std::atomic<int> m_sensorBufferCapacity {256};
+
+    /**
+     * @brief The sensor ring buffers keyed by the device id (high 32 bits) and the sensor type (low 32 bits).
+     */
+    QHash<quint64, GamepadSensorBuffer> m_sensorBuffers;
+
+    /**
+     * @brief The SDL time (in nanoseconds) of the last sensor block delivery.
+     */
+    Uint64 m_lastSensorFlush = 0;
+
+    /**
+     * @brief Set when at least one sensor ring buffer contains samples.
+     */
+    bool m_sensorSamplesPending = false;
+
+    /**
+     * @brief Protects the sensor requests.
+     */
+    QMutex m_sensorMutex;
+
+    /**
+     * @brief The sensor requests changed by `requestSensor()` and `releaseSensor()`.
+     */
+    QList<SensorRequest> m_sensorRequests;
+
+    /**
+     * @brief The id of the next sensor request.
+     */
+    int m_nextSensorRequestId = 1;
+
+    /**
+     * @brief Set when the sensor requests were changed and must be applied by the manager thread.
+     */
+    std::atomic<bool> m_sensorRequestsDirty {false};
+
+    /**
+     * @brief The copy of the sensor requests used by the manager thread.
+     */
+    QList<SensorRequest> m_sensorRequestList;
+
+    /**
+     * @brief Set on the manager thread when the opened gamepads or the sensor requests changed.
+     */
+    bool m_sensorsDirty = false;
+
+    /**
+     * @brief The enabled sensors keyed by the device id (high 32 bits) and the sensor type (low 32 bits).
+     */
+    QHash<quint64, SensorDecimator> m_sensorDecimators;
+
+    /**
+     * @brief Set when at least one enabled sensor is delivered below its native rate.
+     */
+    bool m_sensorDecimation = false;
+
+    /**
+     * @brief Protects the event categories, the device allowlist and the axis filter options requested by the user.
+     */
+    mutable QMutex m_filtersMutex;
+
+    /**
+     * @brief The event categories requested by the user.
+     */
+    EventCategories m_eventCategories = AllCategories;
+
+    /**
+     * @brief The device allowlist requested by the user.
+     */
+    DeviceAllowlist m_deviceAllowlist;
+
+    /**
+     * @brief The axis filter option requested by the user.
+     */
+    bool m_axisFilterEnabled = false;
+
+    /**
+     * @brief The default axis filter settings requested by the user.
+     */
+    GamepadAxisFilter::Settings m_axisFilterSettings;
+
+    /**
+     * @brief The per-device axis filter settings requested by the user.
+     */
+    QHash<SDL_JoystickID, GamepadAxisFilter::Settings> m_deviceAxisFilterSettings;
+
+    /**
+     * @brief Set when the options protected by `m_filtersMutex` were changed.
+     */
+    std::atomic<bool> m_filtersDirty {false};
+
+    /**
+     * @brief The event categories applied to SDL by the manager thread.
+     */
+    EventCategories m_activeCategories = AllCategories;
+
+    /**
+     * @brief The `QSDLEventFactory::registeredEventsRevision()` of the user event types disabled by the manager thread.
+     */
+    quint32 m_userEventsRevision = 0;
+
+    /**
+     * @brief The device allowlist applied by the manager thread.
+     */
+    DeviceAllowlist m_activeAllowlist;
+
+    /**
+     * @brief The axis filter option applied on the manager thread.
+     */
+    bool m_axisFilterActive = false;
+
+    /**
+     * @brief The deadzone, response curve and hysteresis stage of axis events.
+     */
+    GamepadAxisFilter m_axisFilter;
+
+    /**
+     * @brief The connected gamepads rejected by the device allowlist.
+     */
+    QSet<SDL_JoystickID> m_ignoredDevices;
+
+    /**
+     * @brief The collected metrics, shared with the posted events that record their delivery.
+     */
+    std::shared_ptr<SDLEventMetrics> m_metrics = std::make_shared<SDLEventMetrics>();
+
+    /**
+     * @brief Set while metrics are collected.
+     */
+    std::atomic<bool> m_metricsEnabled {false};
+
+    /**
+     * @brief The interval of the `metricsUpdated()` signal in milliseconds, 0 if disabled.
+     */
+    std::atomic<int> m_metricsInterval {0};
+
+    /**
+     * @brief The SDL time (in nanoseconds) of the last `metricsUpdated()` signal.
+     */
+    Uint64 m_lastMetricsReport = 0;
+
+    /**
+     * @brief The SDL time (in nanoseconds) at which the events of the current cycle are posted.
+     */
+    Uint64 m_postTimestamp = 0;
+
+    /**
+     * @brief The metrics attached to the events posted in the current cycle, or nullptr if disabled.
+     */
+    std::shared_ptr<SDLEventMetrics> m_postMetrics;
+
+    /**
+     * @brief The number of SDL events posted in the current cycle, counted when the metrics are enabled.
+     */
+    quint64 m_cyclePosted = 0;
+
+    /**
+     * @brief Protects the recorder and the replay requests.
+     */
+    mutable QMutex m_captureMutex;
+
+    /**
+     * @brief The attached recorder.
+     */
+    InputRecorder* m_recorder = nullptr;
+
+    /**
+     * @brief The recorder that already received the descriptions of the opened gamepads.
+     */
+    InputRecorder* m_recordedBy = nullptr;
+
+    /**
+     * @brief Set while a recorder is attached.
+     */
+    std::atomic<bool> m_recording {false};
+
+    /**
+     * @brief The SDL events drained during the current cycle, kept for the recorder.
+     */
+    QList<SDL_Event> m_recordBuffer;
+
+    /**
+     * @brief The replay requested by `startReplay()`.
+     */
+    std::unique_ptr<InputReplay> m_pendingReplay;
+
+    /**
+     * @brief The speed requested by `startReplay()`.
+     */
+    double m_pendingReplaySpeed = 1.0;
+
+    /**
+     * @brief Set when a replay was started or stopped.
+     */
+    std::atomic<bool> m_replayChanged {false};
+
+    /**
+     * @brief Set while a replay is requested or running.
+     */
+    std::atomic<bool> m_replaying {false};
+
+    /**
+     * @brief The running replay.
+     */
+    std::unique_ptr<InputReplay> m_replay;
+
+    /**
+     * @brief The speed of the running replay, 0 for as fast as possible.
+     */
+    double m_replaySpeed = 1.0;
+
+    /**
+     * @brief The SDL time (in nanoseconds) at which the running replay was started.
+     */
+    Uint64 m_replayStart = 0;
+
+    /**
+     * @brief The recorded timestamp of the first replayed event.
+     */
+    Uint64 m_replayFirst = 0;
+
+    /**
+     * @brief Set when the first event of the replay was read.
+     */
+    bool m_replayStarted = false;
+
+    /**
+     * @brief The next replayed event that is not due yet.
+     */
+    SDL_Event m_replayEvent {};
+
+    /**
+     * @brief Set when `m_replayEvent` holds an event.
+     */
+    bool m_replayHasEvent = false;
+
+    /**
+     * @brief Set while a replayed event is processed, so no real gamepad is opened for it.
+     */
+    bool m_processingReplay = false;
+
+    /**
+     * @brief The gamepads registered by the running replay.
+     */
+    QSet<SDL_JoystickID> m_replayDevices;
+
+    /**
+     * @brief The descriptions of the gamepads stored in the device records of the running replay.
+     */
+    QHash<SDL_JoystickID, DeviceInfo> m_replayDeviceInfo;
+
+    /**
+     * @brief The currently opened `SDL_Gamepad` objects and their descriptions, in dense slots.
+     */
+    DeviceSlotMap m_devices;
+
+    /**
+     * @brief Protects `m_deviceInfos`.
+     */
+    mutable QMutex m_devicesMutex;
+
+    /**
+     * @brief The descriptions of the opened devices published for other threads, indexed by slot.
+     */
+    QList<std::shared_ptr<const DeviceInfo>> m_deviceInfos;
+};
+} // namespace QtSDL
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QtSDL::SDLEventManager::EventMask)
+Q_DECLARE_OPERATORS_FOR_FLAGS(QtSDL::SDLEventManager::EventCategories)
 
 #endif // SDLEVENTMANAGER_H
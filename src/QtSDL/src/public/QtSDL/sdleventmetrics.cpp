@@ -0,0 +1,141 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+#include "sdleventmetrics.h"
+#include <bit>
+#include <cmath>
+
+namespace QtSDL {
+
+namespace {
+
+constexpr std::size_t USER_SLOT = SDLEventTypes::entries().size();
+constexpr std::size_t UNKNOWN_SLOT = USER_SLOT + 1;
+
+std::size_t typeSlot(Uint32 type) {
+    const qsizetype index = SDLEventTypes::indexOf(type);
+    if (index >= 0) {
+        return static_cast<std::size_t>(index);
+    }
+
+    return (type >= SDL_EVENT_USER && type <= SDL_EVENT_LAST)? USER_SLOT: UNKNOWN_SLOT;
+}
+}
+
+double MetricsHistogram::mean() const {
+    return (count)? static_cast<double>(sum) / count: 0.0;
+}
+
+quint64 MetricsHistogram::percentile(double percent) const {
+    if (!count) {
+        return 0;
+    }
+
+    const quint64 rank = std::max<quint64>(1, static_cast<quint64>(std::ceil(count * percent / 100.0)));
+    quint64 seen = 0;
+    for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            const quint64 upper = (bucket >= 64)? max: (quint64(1) << bucket) - 1;
+            return std::min(upper, max);
+        }
+    }
+
+    return max;
+}
+
+void SDLEventMetrics::Histogram::record(quint64 value, quint64 times) {
+    buckets[std::bit_width(value)].fetch_add(times, std::memory_order_relaxed);
+    count.fetch_add(times, std::memory_order_relaxed);
+    sum.fetch_add(value * times, std::memory_order_relaxed);
+
+    quint64 current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+MetricsHistogram SDLEventMetrics::Histogram::snapshot() const {
+    MetricsHistogram result;
+    for (int bucket = 0; bucket < MetricsHistogram::BUCKETS; ++bucket) {
+        result.buckets[bucket] = buckets[bucket].load(std::memory_order_relaxed);
+    }
+
+    result.count = count.load(std::memory_order_relaxed);
+    result.sum = sum.load(std::memory_order_relaxed);
+    result.max = max.load(std::memory_order_relaxed);
+    return result;
+}
+
+void SDLEventMetrics::Histogram::reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+SDLEventMetrics::SDLEventMetrics() {
+
+}
+
+void SDLEventMetrics::recordPosted(Uint32 type, Uint64 latency) {
+    _pollToPost.record(latency);
+    _typeCounts[typeSlot(type)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void SDLEventMetrics::recordDelivered(Uint64 latency, quint64 events) {
+    _postToDelivery.record(latency, events);
+}
+
+void SDLEventMetrics::recordCycle(quint64 events) {
+    _eventsPerCycle.record(events);
+}
+
+void SDLEventMetrics::recordUnposted(quint64 events) {
+    if (events) {
+        _unposted.fetch_add(events, std::memory_order_relaxed);
+    }
+}
+
+SDLEventMetricsSnapshot SDLEventMetrics::snapshot() const {
+    SDLEventMetricsSnapshot result;
+    result.pollToPost = _pollToPost.snapshot();
+    result.postToDelivery = _postToDelivery.snapshot();
+    result.eventsPerCycle = _eventsPerCycle.snapshot();
+    result.unposted = _unposted.load(std::memory_order_relaxed);
+
+    const auto& entries = SDLEventTypes::entries();
+    for (std::size_t slot = 0; slot < TYPE_SLOTS; ++slot) {
+        const quint64 count = _typeCounts[slot].load(std::memory_order_relaxed);
+        if (!count) {
+            continue;
+        }
+
+        if (slot < entries.size()) {
+            result.typeCounts.insert(entries[slot].type, count);
+        } else {
+            result.typeCounts.insert((slot == USER_SLOT)? SDL_EVENT_USER: SDL_EVENT_FIRST, count);
+        }
+    }
+
+    result.timestamp = SDL_GetTicksNS();
+    return result;
+}
+
+void SDLEventMetrics::reset() {
+    _pollToPost.reset();
+    _postToDelivery.reset();
+    _eventsPerCycle.reset();
+    _unposted.store(0, std::memory_order_relaxed);
+
+    for (auto& count : _typeCounts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+}
@@ -0,0 +1,152 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef SDLEVENTMETRICS_H
+#define SDLEVENTMETRICS_H
+
+#include <QHash>
+#include <QMetaType>
+#include <SDL3/SDL.h>
+#include <array>
+#include <atomic>
+#include "global.h"
+#include "sdleventtypes.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The MetricsHistogram struct is a snapshot of a histogram with power-of-two buckets.
+ *
+ * The bucket N counts the values from 2^(N-1) to 2^N - 1, the bucket 0 counts zeros.
+ */
+struct QTSDL_EXPORT MetricsHistogram {
+    /// The number of buckets, enough for any 64-bit value.
+    static constexpr int BUCKETS = 65;
+
+    /// The number of values in each bucket.
+    std::array<quint64, BUCKETS> buckets {};
+    /// The number of recorded values.
+    quint64 count = 0;
+    /// The sum of recorded values.
+    quint64 sum = 0;
+    /// The largest recorded value.
+    quint64 max = 0;
+
+    /**
+     * @brief Returns the mean of the recorded values.
+     */
+    double mean() const;
+
+    /**
+     * @brief Estimates a percentile of the recorded values.
+     * @param percent The percentile, from 0 to 100.
+     * @return The upper bound of the bucket that contains the percentile, limited by `max`.
+     */
+    quint64 percentile(double percent) const;
+};
+
+/**
+ * @brief The SDLEventMetricsSnapshot struct contains the metrics collected by `SDLEventManager`.
+ *
+ * All latencies are in nanoseconds of the SDL clock (`SDL_GetTicksNS()`).
+ */
+struct QTSDL_EXPORT SDLEventMetricsSnapshot {
+    /// The time between the SDL timestamp of an event and the moment the manager posted it.
+    /// An event posted to several receivers is counted once per receiver.
+    MetricsHistogram pollToPost;
+    /// The time between posting an event and releasing it after the receiver handled it.
+    MetricsHistogram postToDelivery;
+    /// The number of events posted per polling cycle.
+    MetricsHistogram eventsPerCycle;
+    /// The number of posted events per SDL event type. All user events are counted as `SDL_EVENT_USER`,
+    /// and unknown types as `SDL_EVENT_FIRST`.
+    QHash<Uint32, quint64> typeCounts;
+    /// The number of drained events that were not posted: events without subscribers
+    /// and all events of the `SDLEventManager::DeliveryMode::Direct` mode.
+    quint64 unposted = 0;
+    /// The SDL time (in nanoseconds) at which the snapshot was taken.
+    Uint64 timestamp = 0;
+};
+
+/**
+ * @brief The SDLEventMetrics class collects latency and throughput metrics of `SDLEventManager`.
+ *
+ * All counters are relaxed atomics, so the manager thread and the threads that release
+ * delivered events record values without locks. `snapshot()` may run on any thread;
+ * its counters are read one by one, so a snapshot taken under load is not an atomic cut.
+ */
+class QTSDL_EXPORT SDLEventMetrics
+{
+public:
+    SDLEventMetrics();
+
+    /**
+     * @brief Records the poll-to-post latency and the type of a posted event.
+     * @param type The SDL event type.
+     * @param latency The latency in nanoseconds.
+     */
+    void recordPosted(Uint32 type, Uint64 latency);
+
+    /**
+     * @brief Records the post-to-delivery latency of delivered events.
+     * @param latency The latency in nanoseconds.
+     * @param events The number of events delivered together, for example in one `QSDLEventBatch`.
+     */
+    void recordDelivered(Uint64 latency, quint64 events = 1);
+
+    /**
+     * @brief Records the number of events posted in one polling cycle.
+     * @param events The number of events.
+     */
+    void recordCycle(quint64 events);
+
+    /**
+     * @brief Records drained events that were not posted to any receiver.
+     * @param events The number of events.
+     */
+    void recordUnposted(quint64 events);
+
+    /**
+     * @brief Returns a snapshot of all metrics.
+     */
+    SDLEventMetricsSnapshot snapshot() const;
+
+    /**
+     * @brief Resets all metrics.
+     */
+    void reset();
+
+private:
+    /**
+     * @brief The Histogram struct is the lock-free counterpart of `MetricsHistogram`.
+     */
+    struct Histogram {
+        std::array<std::atomic<quint64>, MetricsHistogram::BUCKETS> buckets {};
+        std::atomic<quint64> count {0};
+        std::atomic<quint64> sum {0};
+        std::atomic<quint64> max {0};
+
+        void record(quint64 value, quint64 times = 1);
+        MetricsHistogram snapshot() const;
+        void reset();
+    };
+
+    /// The counters of the known SDL event types, then of user events and of unknown events.
+    static constexpr std::size_t TYPE_SLOTS = SDLEventTypes::entries().size() + 2;
+
+    Histogram _pollToPost;
+    Histogram _postToDelivery;
+    Histogram _eventsPerCycle;
+    std::array<std::atomic<quint64>, TYPE_SLOTS> _typeCounts {};
+    std::atomic<quint64> _unposted {0};
+};
+} // namespace QtSDL
+
+Q_DECLARE_METATYPE(QtSDL::SDLEventMetricsSnapshot)
+
+#endif // SDLEVENTMETRICS_H
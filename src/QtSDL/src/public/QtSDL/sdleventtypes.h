@@ -0,0 +1,279 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef SDLEVENTTYPES_H
+#define SDLEVENTTYPES_H
+
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include "global.h"
+
+namespace QtSDL {
+
+/**
+ * @brief The SDLEventTypes class maps SDL3 event types to their names and back.
+ *
+ * Both lookups are `constexpr` and work on a compile-time table, so they never allocate.
+ * A name resolved from a constant, for example in a configuration schema, costs nothing at runtime:
+ *
+ * @code{cpp}
+ * constexpr Uint32 type = QtSDL::SDLEventTypes::fromName("SDL_EVENT_GAMEPAD_BUTTON_DOWN");
+ * @endcode
+ *
+ * At runtime both lookups are binary searches over sorted tables.
+ */
+class SDLEventTypes
+{
+public:
+    /**
+     * @brief The Entry struct is a pair of an SDL event type and its name.
+     */
+    struct Entry {
+        Uint32 type;
+        std::string_view name;
+    };
+
+    /**
+     * @brief The name returned for types registered with `SDL_RegisterEvents()`.
+     */
+    static constexpr std::string_view USER_EVENT_NAME = "SDL_EVENT_USER";
+
+    /**
+     * @brief The name returned for types that are not known to this version of the library.
+     */
+    static constexpr std::string_view UNKNOWN_EVENT_NAME = "SDL_EVENT_UNKNOWN";
+
+    /**
+     * @brief Returns the name of an SDL event type.
+     * @param type The SDL event type.
+     * @return The name of the `SDL_EventType` enumerator, `USER_EVENT_NAME` for user events
+     * or `UNKNOWN_EVENT_NAME` for unknown types. The string is static and null-terminated.
+     */
+    static constexpr std::string_view name(Uint32 type) {
+        auto it = std::lower_bound(BY_TYPE.begin(), BY_TYPE.end(), type, [](const Entry& entry, Uint32 value) {
+            return entry.type < value;
+        });
+
+        if (it != BY_TYPE.end() && it->type == type) {
+            return it->name;
+        }
+
+        if (type >= SDL_EVENT_USER && type <= SDL_EVENT_LAST) {
+            return USER_EVENT_NAME;
+        }
+
+        return UNKNOWN_EVENT_NAME;
+    }
+
+    /**
+     * @brief Returns the position of an SDL event type in `entries()`.
+     * @param type The SDL event type.
+     * @return The index of the type, or -1 for user and unknown types.
+     */
+    static constexpr qsizetype indexOf(Uint32 type) {
+        auto it = std::lower_bound(BY_TYPE.begin(), BY_TYPE.end(), type, [](const Entry& entry, Uint32 value) {
+            return entry.type < value;
+        });
+
+        if (it != BY_TYPE.end() && it->type == type) {
+            return it - BY_TYPE.begin();
+        }
+
+        return -1;
+    }
+
+    /**
+     * @brief Returns the SDL event type of a name.
+     * @param name The name of the `SDL_EventType` enumerator, for example `"SDL_EVENT_KEY_DOWN"`.
+     * @return The SDL event type, or `SDL_EVENT_FIRST` (0) if the name is unknown.
+     */
+    static constexpr Uint32 fromName(std::string_view name) {
+        auto it = std::lower_bound(BY_NAME.begin(), BY_NAME.end(), name, [](const Entry& entry, std::string_view value) {
+            return entry.name < value;
+        });
+
+        if (it != BY_NAME.end() && it->name == name) {
+            return it->type;
+        }
+
+        return SDL_EVENT_FIRST;
+    }
+
+    /**
+     * @brief Returns all known SDL event types sorted by type.
+     */
+    static constexpr const auto& entries() {
+        return BY_TYPE;
+    }
+
+private:
+#define QTSDL_EVENT_TYPE(type) Entry{type, #type}
+    static constexpr std::array BY_TYPE {
+        // Application events
+        QTSDL_EVENT_TYPE(SDL_EVENT_QUIT),
+        QTSDL_EVENT_TYPE(SDL_EVENT_TERMINATING),
+        QTSDL_EVENT_TYPE(SDL_EVENT_LOW_MEMORY),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WILL_ENTER_BACKGROUND),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DID_ENTER_BACKGROUND),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WILL_ENTER_FOREGROUND),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DID_ENTER_FOREGROUND),
+        QTSDL_EVENT_TYPE(SDL_EVENT_LOCALE_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_SYSTEM_THEME_CHANGED),
+
+        // Display events
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_ORIENTATION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_REMOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_MOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_DESKTOP_MODE_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DISPLAY_CONTENT_SCALE_CHANGED),
+
+        // Window events
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_SHOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_HIDDEN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_EXPOSED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_MOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_RESIZED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_METAL_VIEW_RESIZED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_MINIMIZED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_MAXIMIZED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_RESTORED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_MOUSE_ENTER),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_MOUSE_LEAVE),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_FOCUS_GAINED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_FOCUS_LOST),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_CLOSE_REQUESTED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_HIT_TEST),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_ICCPROF_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_DISPLAY_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_DISPLAY_SCALE_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_SAFE_AREA_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_OCCLUDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_ENTER_FULLSCREEN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_LEAVE_FULLSCREEN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_DESTROYED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_WINDOW_HDR_STATE_CHANGED),
+
+        // Keyboard events
+        QTSDL_EVENT_TYPE(SDL_EVENT_KEY_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_KEY_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_TEXT_EDITING),
+        QTSDL_EVENT_TYPE(SDL_EVENT_TEXT_INPUT),
+        QTSDL_EVENT_TYPE(SDL_EVENT_KEYMAP_CHANGED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_KEYBOARD_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_KEYBOARD_REMOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_TEXT_EDITING_CANDIDATES),
+
+        // Mouse events
+        QTSDL_EVENT_TYPE(SDL_EVENT_MOUSE_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_MOUSE_BUTTON_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_MOUSE_BUTTON_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_MOUSE_WHEEL),
+        QTSDL_EVENT_TYPE(SDL_EVENT_MOUSE_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_MOUSE_REMOVED),
+
+        // Joystick events
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_AXIS_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_BALL_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_HAT_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_BUTTON_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_BUTTON_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_REMOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_BATTERY_UPDATED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_JOYSTICK_UPDATE_COMPLETE),
+
+        // Gamepad events
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_AXIS_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_BUTTON_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_BUTTON_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_REMOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_REMAPPED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_TOUCHPAD_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_SENSOR_UPDATE),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_UPDATE_COMPLETE),
+        QTSDL_EVENT_TYPE(SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED),
+
+        // Touch events
+        QTSDL_EVENT_TYPE(SDL_EVENT_FINGER_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_FINGER_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_FINGER_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_FINGER_CANCELED),
+
+        // Clipboard events
+        QTSDL_EVENT_TYPE(SDL_EVENT_CLIPBOARD_UPDATE),
+
+        // Drag and drop events
+        QTSDL_EVENT_TYPE(SDL_EVENT_DROP_FILE),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DROP_TEXT),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DROP_BEGIN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DROP_COMPLETE),
+        QTSDL_EVENT_TYPE(SDL_EVENT_DROP_POSITION),
+
+        // Audio hotplug events
+        QTSDL_EVENT_TYPE(SDL_EVENT_AUDIO_DEVICE_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_AUDIO_DEVICE_REMOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_AUDIO_DEVICE_FORMAT_CHANGED),
+
+        // Sensor events
+        QTSDL_EVENT_TYPE(SDL_EVENT_SENSOR_UPDATE),
+
+        // Pen events
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_PROXIMITY_IN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_PROXIMITY_OUT),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_BUTTON_DOWN),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_BUTTON_UP),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_MOTION),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PEN_AXIS),
+
+        // Camera hotplug events
+        QTSDL_EVENT_TYPE(SDL_EVENT_CAMERA_DEVICE_ADDED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_CAMERA_DEVICE_REMOVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_CAMERA_DEVICE_APPROVED),
+        QTSDL_EVENT_TYPE(SDL_EVENT_CAMERA_DEVICE_DENIED),
+
+        // Render events
+        QTSDL_EVENT_TYPE(SDL_EVENT_RENDER_TARGETS_RESET),
+        QTSDL_EVENT_TYPE(SDL_EVENT_RENDER_DEVICE_RESET),
+        QTSDL_EVENT_TYPE(SDL_EVENT_RENDER_DEVICE_LOST),
+
+        // Internal events
+        QTSDL_EVENT_TYPE(SDL_EVENT_PRIVATE0),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PRIVATE1),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PRIVATE2),
+        QTSDL_EVENT_TYPE(SDL_EVENT_PRIVATE3),
+        QTSDL_EVENT_TYPE(SDL_EVENT_POLL_SENTINEL),
+
+        // User events
+        QTSDL_EVENT_TYPE(SDL_EVENT_USER),
+    };
+#undef QTSDL_EVENT_TYPE
+
+    static_assert(std::is_sorted(BY_TYPE.begin(), BY_TYPE.end(), [](const Entry& left, const Entry& right) {
+        return left.type < right.type;
+    }), "The event types must follow the order of SDL_EventType");
+
+    static constexpr auto BY_NAME = [] {
+        auto table = BY_TYPE;
+        std::sort(table.begin(), table.end(), [](const Entry& left, const Entry& right) {
+            return left.name < right.name;
+        });
+        return table;
+    }();
+};
+} // namespace QtSDL
+#endif // SDLEVENTTYPES_H
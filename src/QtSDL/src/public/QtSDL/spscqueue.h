@@ -0,0 +1,157 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the lGPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <QtGlobal>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace QtSDL {
+
+/**
+ * @brief The SPSCQueue class is a bounded lock-free queue for one producer thread and one consumer thread.
+ *
+ * The queue is a ring buffer with a power-of-two capacity. `push()` never blocks and never allocates:
+ * when the queue is full the value is dropped and counted by `dropped()`. Each side caches the index
+ * of the other side, so the indexes are shared between the cores only when the cached value runs out.
+ *
+ * Use it to hand SDL events from an `SDLEventManager` handler to a render thread:
+ *
+ * @code
+ * QtSDL::SPSCQueue<SDL_Event> queue(4096);
+ * manager->addEventHandler([&queue](const SDL_Event& event) {
+ *     queue.push(event);
+ * });
+ *
+ * // render thread, right before submit
+ * queue.drain([](const SDL_Event& event) { ... });
+ * @endcode
+ */
+template<class T>
+class SPSCQueue
+{
+public:
+    /**
+     * @brief Constructs a queue.
+     * @param capacity The minimal number of values the queue holds. It is rounded up to a power of two.
+     */
+    explicit SPSCQueue(qsizetype capacity = 1024):
+        _capacity(static_cast<quint64>(std::bit_ceil(static_cast<quint64>(std::max<qsizetype>(capacity, 2))))),
+        _buffer(std::make_unique<T[]>(_capacity)) {
+    }
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /**
+     * @brief Appends a value. Call it from the producer thread only.
+     * @param value The value to append.
+     * @return false if the queue is full and the value was dropped.
+     */
+    bool push(const T& value) {
+        const quint64 tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cachedHead >= _capacity) {
+            _cachedHead = _head.load(std::memory_order_acquire);
+            if (tail - _cachedHead >= _capacity) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        _buffer[tail & (_capacity - 1)] = value;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest value. Call it from the consumer thread only.
+     * @param value Receives the value.
+     * @return false if the queue is empty.
+     */
+    bool pop(T& value) {
+        const quint64 head = _head.load(std::memory_order_relaxed);
+        if (head == _cachedTail) {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if (head == _cachedTail) {
+                return false;
+            }
+        }
+
+        value = _buffer[head & (_capacity - 1)];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Takes all queued values and calls @a func for each of them. Call it from the consumer thread only.
+     * @param func The function called with a constant reference to each value.
+     * @return The number of taken values.
+     */
+    template<class Func>
+    qsizetype drain(Func&& func) {
+        const quint64 head = _head.load(std::memory_order_relaxed);
+        _cachedTail = _tail.load(std::memory_order_acquire);
+
+        for (quint64 index = head; index != _cachedTail; ++index) {
+            func(std::as_const(_buffer[index & (_capacity - 1)]));
+        }
+
+        _head.store(_cachedTail, std::memory_order_release);
+        return static_cast<qsizetype>(_cachedTail - head);
+    }
+
+    /**
+     * @brief Returns the approximate number of queued values.
+     */
+    qsizetype size() const {
+        return static_cast<qsizetype>(_tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Checks whether the queue looks empty.
+     */
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     */
+    qsizetype capacity() const {
+        return static_cast<qsizetype>(_capacity);
+    }
+
+    /**
+     * @brief Returns the number of values dropped because the queue was full.
+     */
+    quint64 dropped() const {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    const quint64 _capacity;
+    std::unique_ptr<T[]> _buffer;
+
+    /// The index of the next value to read, written by the consumer.
+    alignas(64) std::atomic<quint64> _head {0};
+    /// The last tail seen by the consumer.
+    quint64 _cachedTail = 0;
+
+    /// The index of the next value to write, written by the producer.
+    alignas(64) std::atomic<quint64> _tail {0};
+    /// The last head seen by the producer.
+    quint64 _cachedHead = 0;
+    std::atomic<quint64> _dropped {0};
+};
+} // namespace QtSDL
+#endif // SPSCQUEUE_H
@@ -7,6 +7,17 @@
 
 #include <QtTest>
 #include "exampletest.h"
+#include "eventfactorytest.h"
+#include "axisfiltertest.h"
+#include "eventmetricstest.h"
+#include "deviceslotmaptest.h"
+#include "actionmappertest.h"
+#include "touchpadtrackertest.h"
+#include "orientationfiltertest.h"
+#include "inputrecordertest.h"
+#include "spscqueuetest.h"
+#include "eventpooltest.h"
+#include "statecachetest.h"
 
 // Use This macros for initialize your own test classes.
 // Check exampletests
@@ -33,6 +44,17 @@ private slots:
 
     // BEGIN TESTS CASES
     TestCase(exampleTest, ExampleTest)
+    TestCase(eventFactoryTest, EventFactoryTest)
+    TestCase(axisFilterTest, AxisFilterTest)
+    TestCase(eventMetricsTest, EventMetricsTest)
+    TestCase(deviceSlotMapTest, DeviceSlotMapTest)
+    TestCase(actionMapperTest, ActionMapperTest)
+    TestCase(touchpadTrackerTest, TouchpadTrackerTest)
+    TestCase(orientationFilterTest, OrientationFilterTest)
+    TestCase(inputRecorderTest, InputRecorderTest)
+    TestCase(spscQueueTest, SPSCQueueTest)
+    TestCase(eventPoolTest, EventPoolTest)
+    TestCase(stateCacheTest, StateCacheTest)
     // END TEST CASES
 
 private:
@@ -0,0 +1,167 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "actionmappertest.h"
+
+#include <QtSDL/gamepadactionmapper.h>
+
+using QtSDL::GamepadActionMap;
+using QtSDL::GamepadActionMapper;
+
+namespace {
+
+enum Action {
+    Jump = 1,
+    Pause,
+    Accelerate,
+    Left
+};
+
+SDL_Event buttonEvent(SDL_GamepadButton button, bool down) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = (down)? SDL_EVENT_GAMEPAD_BUTTON_DOWN: SDL_EVENT_GAMEPAD_BUTTON_UP;
+    event.gbutton.which = 1;
+    event.gbutton.button = button;
+    event.gbutton.down = down;
+    return event;
+}
+
+SDL_Event axisEvent(SDL_GamepadAxis axis, Sint16 value) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+    event.gaxis.which = 1;
+    event.gaxis.axis = axis;
+    event.gaxis.value = value;
+    return event;
+}
+
+GamepadActionMap gameMap() {
+    GamepadActionMap map;
+    map.addAction(Jump, "jump", {GamepadActionMap::button(SDL_GAMEPAD_BUTTON_SOUTH)});
+    map.addAction(Pause, "pause", {GamepadActionMap::chord({SDL_GAMEPAD_BUTTON_BACK, SDL_GAMEPAD_BUTTON_START})});
+    map.addAction(Accelerate, "accelerate", {GamepadActionMap::axis(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 0.5f, 0.1f)});
+    map.addAction(Left, "left", {GamepadActionMap::axis(SDL_GAMEPAD_AXIS_LEFTX, -0.5f),
+                                 GamepadActionMap::button(SDL_GAMEPAD_BUTTON_DPAD_LEFT)});
+    return map;
+}
+}
+
+ActionMapperTest::ActionMapperTest() {
+
+}
+
+ActionMapperTest::~ActionMapperTest() {
+
+}
+
+void ActionMapperTest::test() {
+    testChord();
+    testThreshold();
+    testRemap();
+}
+
+void ActionMapperTest::testChord() {
+    GamepadActionMapper mapper;
+    QList<GamepadActionMapper::Transition> transitions;
+    mapper.setMaps(gameMap(), {}, 0, transitions);
+    mapper.addDevice(1, nullptr, 0, transitions);
+    QVERIFY(transitions.isEmpty());
+
+    // Raw events of bound buttons are consumed, and only state changes produce transitions.
+    QVERIFY(mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_BACK, true), transitions));
+    QVERIFY(transitions.isEmpty());
+
+    // Buttons and axes that no action is bound to are not consumed.
+    QVERIFY(!mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_NORTH, true), transitions));
+    QVERIFY(!mapper.process(axisEvent(SDL_GAMEPAD_AXIS_RIGHTY, 30000), transitions));
+    QVERIFY(transitions.isEmpty());
+
+    mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_START, true), transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+    QCOMPARE(transitions.first().action, int(Pause));
+    QCOMPARE(transitions.first().name, QString("pause"));
+    QVERIFY(transitions.first().active);
+    QVERIFY(mapper.isActive(1, Pause));
+
+    transitions.clear();
+    mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_BACK, false), transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+    QVERIFY(!transitions.first().active);
+
+    // An action stays active while any of its bindings is active.
+    transitions.clear();
+    mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_DPAD_LEFT, true), transitions);
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_LEFTX, -30000), transitions);
+    mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_DPAD_LEFT, false), transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+    QVERIFY(mapper.isActive(1, Left));
+
+    // A disconnection releases the active actions.
+    transitions.clear();
+    mapper.removeDevice(1, 0, transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+    QCOMPARE(transitions.first().action, int(Left));
+    QVERIFY(!transitions.first().active);
+
+    // Events of untracked gamepads are not consumed.
+    QVERIFY(!mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_SOUTH, true), transitions));
+}
+
+void ActionMapperTest::testThreshold() {
+    GamepadActionMapper mapper;
+    QList<GamepadActionMapper::Transition> transitions;
+    mapper.setMaps(gameMap(), {}, 0, transitions);
+    mapper.addDevice(1, nullptr, 0, transitions);
+
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 10000), transitions);
+    QVERIFY(transitions.isEmpty());
+
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 20000), transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+    QVERIFY(transitions.first().active);
+
+    // Values inside the hysteresis band do not release the action.
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 15000), transitions);
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 17000), transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_RIGHT_TRIGGER, 12000), transitions);
+    QCOMPARE(transitions.size(), qsizetype(2));
+    QVERIFY(!transitions.last().active);
+
+    // A negative threshold is reached in the negative direction only.
+    transitions.clear();
+    mapper.process(axisEvent(SDL_GAMEPAD_AXIS_LEFTX, 30000), transitions);
+    QVERIFY(transitions.isEmpty());
+}
+
+void ActionMapperTest::testRemap() {
+    GamepadActionMapper mapper;
+    QList<GamepadActionMapper::Transition> transitions;
+    mapper.setMaps(gameMap(), {}, 0, transitions);
+    mapper.addDevice(1, nullptr, 0, transitions);
+    mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_SOUTH, true), transitions);
+    mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_EAST, true), transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+
+    // Jump is moved to the held east button: it stays active, so no transition is produced.
+    GamepadActionMap remapped;
+    remapped.addAction(Jump, "jump", {GamepadActionMap::button(SDL_GAMEPAD_BUTTON_EAST)});
+    transitions.clear();
+    mapper.setMaps({}, {{1, remapped}}, 0, transitions);
+    QVERIFY(transitions.isEmpty());
+    QVERIFY(mapper.isActive(1, Jump));
+
+    // An empty map releases the action and forwards the raw input.
+    mapper.setMaps({}, {}, 0, transitions);
+    QCOMPARE(transitions.size(), qsizetype(1));
+    QVERIFY(!transitions.first().active);
+    QVERIFY(!mapper.process(buttonEvent(SDL_GAMEPAD_BUTTON_SOUTH, false), transitions));
+}
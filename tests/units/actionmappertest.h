@@ -0,0 +1,34 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef ACTIONMAPPER_TEST_H
+#define ACTIONMAPPER_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The ActionMapperTest class checks the chords, axis thresholds and remapping of GamepadActionMapper.
+ */
+class ActionMapperTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    ActionMapperTest();
+    ~ActionMapperTest();
+
+    void test();
+
+private:
+    void testChord();
+    void testThreshold();
+    void testRemap();
+};
+
+#endif // ACTIONMAPPER_TEST_H
@@ -0,0 +1,118 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "axisfiltertest.h"
+
+#include <QtSDL/gamepadaxisfilter.h>
+
+#include <QRandomGenerator>
+
+using QtSDL::GamepadAxisFilter;
+
+namespace {
+
+SDL_Event axisEvent(Uint8 axis, Sint16 value) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+    event.gaxis.which = 1;
+    event.gaxis.axis = axis;
+    event.gaxis.value = value;
+    return event;
+}
+
+/**
+ * @brief The seed of the random samples, fixed so a failure can be reproduced.
+ */
+constexpr quint32 SAMPLES_SEED = 0x51D1;
+
+struct Samples {
+    QList<qint16> x, y;
+    QList<float> deadzone, invRange, curve;
+
+    Samples(qsizetype count, quint32 seed) {
+        QRandomGenerator random(seed);
+        for (qsizetype i = 0; i < count; ++i) {
+            GamepadAxisFilter::Settings settings;
+            settings.deadzone = random.bounded(0.3);
+            settings.curve = random.bounded(1.0);
+            const auto params = GamepadAxisFilter::Params::fromSettings(settings);
+
+            x.append(static_cast<qint16>(random.bounded(-32768, 32768)));
+            y.append(static_cast<qint16>(random.bounded(-32768, 32768)));
+            deadzone.append(params.deadzone);
+            invRange.append(params.invRange);
+            curve.append(params.curve);
+        }
+    }
+};
+}
+
+AxisFilterTest::AxisFilterTest() {
+
+}
+
+AxisFilterTest::~AxisFilterTest() {
+
+}
+
+void AxisFilterTest::test() {
+    testTransform();
+    testHysteresis();
+}
+
+void AxisFilterTest::testTransform() {
+    // An odd size also covers the scalar tail of the SIMD loops.
+    Samples samples(1001, SAMPLES_SEED);
+    QList<float> simd(samples.x.size());
+    QList<float> scalar(samples.x.size());
+
+    GamepadAxisFilter::transform(samples.x.constData(), samples.y.constData(), samples.deadzone.constData(),
+                                 samples.invRange.constData(), samples.curve.constData(),
+                                 simd.data(), samples.x.size());
+    GamepadAxisFilter::transformScalar(samples.x.constData(), samples.y.constData(), samples.deadzone.constData(),
+                                       samples.invRange.constData(), samples.curve.constData(),
+                                       scalar.data(), samples.x.size());
+
+    for (qsizetype i = 0; i < simd.size(); ++i) {
+        const QByteArray sample = QString("seed %1, sample %2").arg(SAMPLES_SEED).arg(i).toLatin1();
+        QVERIFY2(std::abs(simd[i] - scalar[i]) < 1e-5f, sample.constData());
+        QVERIFY2(simd[i] >= -1.0f && simd[i] <= 1.0f, sample.constData());
+    }
+
+    const auto params = GamepadAxisFilter::Params::fromSettings({});
+    const qint16 x[] = {1000, 32767, -32768};
+    const qint16 y[] = {1000, 0, 0};
+    const float deadzone[] = {params.deadzone, params.deadzone, params.deadzone};
+    const float invRange[] = {params.invRange, params.invRange, params.invRange};
+    const float curve[] = {params.curve, params.curve, params.curve};
+    float out[3];
+    GamepadAxisFilter::transform(x, y, deadzone, invRange, curve, out, 3);
+
+    QCOMPARE(out[0], 0.0f);
+    QCOMPARE(out[1], 1.0f);
+    QCOMPARE(out[2], -1.0f);
+}
+
+void AxisFilterTest::testHysteresis() {
+    GamepadAxisFilter filter;
+    QList<SDL_Event> events = {
+        axisEvent(SDL_GAMEPAD_AXIS_LEFTX, 1000),   // inside the deadzone
+        axisEvent(SDL_GAMEPAD_AXIS_LEFTX, 20000),
+        axisEvent(SDL_GAMEPAD_AXIS_LEFTX, 20100),  // below the hysteresis threshold
+        axisEvent(SDL_GAMEPAD_AXIS_LEFTX, 0),      // back to the rest position
+    };
+
+    QCOMPARE(filter.process(events), qsizetype(2));
+    QCOMPARE(events[0].type, static_cast<Uint32>(SDL_EVENT_FIRST));
+    QCOMPARE(events[1].type, static_cast<Uint32>(SDL_EVENT_GAMEPAD_AXIS_MOTION));
+    QVERIFY(events[1].gaxis.value < 20000);
+    QCOMPARE(events[2].type, static_cast<Uint32>(SDL_EVENT_FIRST));
+    QCOMPARE(events[3].type, static_cast<Uint32>(SDL_EVENT_GAMEPAD_AXIS_MOTION));
+    QCOMPARE(events[3].gaxis.value, static_cast<Sint16>(0));
+}
@@ -0,0 +1,33 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef AXISFILTER_TEST_H
+#define AXISFILTER_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The AxisFilterTest class checks the GamepadAxisFilter stage.
+ */
+class AxisFilterTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    AxisFilterTest();
+    ~AxisFilterTest();
+
+    void test();
+
+private:
+    void testTransform();
+    void testHysteresis();
+};
+
+#endif // AXISFILTER_TEST_H
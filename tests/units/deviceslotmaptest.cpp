@@ -0,0 +1,75 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "deviceslotmaptest.h"
+
+#include <QtSDL/deviceslotmap.h>
+
+using QtSDL::DeviceInfo;
+using QtSDL::DeviceSlot;
+using QtSDL::DeviceSlotMap;
+
+DeviceSlotMapTest::DeviceSlotMapTest() {
+
+}
+
+DeviceSlotMapTest::~DeviceSlotMapTest() {
+
+}
+
+void DeviceSlotMapTest::test() {
+    testSlots();
+    testRetired();
+}
+
+void DeviceSlotMapTest::testSlots() {
+    DeviceSlotMap map;
+
+    DeviceInfo info;
+    info.name = "first";
+    const DeviceSlot first = map.insert(10, nullptr, info);
+    const DeviceSlot second = map.insert(20, nullptr, {});
+
+    QCOMPARE(first.index, qint16(0));
+    QCOMPARE(second.index, qint16(1));
+    QCOMPARE(map.slotCount(), qsizetype(2));
+    QVERIFY(map.contains(10));
+    QCOMPARE(map.slot(20), second);
+    QCOMPARE(map.entries().first().info->name, QString("first"));
+    QCOMPARE(map.entries().first().info->slot, first);
+    QVERIFY(!map.slot(30).isValid());
+
+    // The freed slot is reused by the next device with a new generation.
+    map.remove(10);
+    QVERIFY(map.releaseRetired());
+    const DeviceSlot third = map.insert(30, nullptr, {});
+    QCOMPARE(third.index, first.index);
+    QVERIFY(third.generation != first.generation);
+    QCOMPARE(map.slotCount(), qsizetype(2));
+}
+
+void DeviceSlotMapTest::testRetired() {
+    DeviceSlotMap map;
+    const DeviceSlot slot = map.insert(10, nullptr, {});
+    const QtSDL::DeviceSlotTable table = map.table();
+
+    // A removed device keeps its slot until the end of the cycle.
+    map.remove(10);
+    QVERIFY(!map.contains(10));
+    QCOMPARE(map.slot(10), slot);
+
+    // A device added in the same cycle does not take the retired slot.
+    QCOMPARE(map.insert(20, nullptr, {}).index, qint16(1));
+
+    QVERIFY(map.releaseRetired());
+    QVERIFY(!map.slot(10).isValid());
+    QVERIFY(!map.releaseRetired());
+
+    // Tables handed out earlier are not changed.
+    QCOMPARE(QtSDL::findDeviceSlot(table, 10), slot);
+}
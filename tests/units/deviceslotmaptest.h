@@ -0,0 +1,33 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef DEVICESLOTMAP_TEST_H
+#define DEVICESLOTMAP_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The DeviceSlotMapTest class checks the slot reuse, generations and retired devices of DeviceSlotMap.
+ */
+class DeviceSlotMapTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    DeviceSlotMapTest();
+    ~DeviceSlotMapTest();
+
+    void test();
+
+private:
+    void testSlots();
+    void testRetired();
+};
+
+#endif // DEVICESLOTMAP_TEST_H
@@ -0,0 +1,143 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "eventfactorytest.h"
+
+#include <QtSDL/qsdleventfactory.h>
+#include <QtSDL/qsdlgamepadaxisevent.h>
+#include <QtSDL/qsdlgamepadbuttonevent.h>
+#include <QtSDL/qsdlgamepadevent.h>
+#include <QtSDL/qsdlgamepadsensorevent.h>
+#include <QtSDL/qsdlgamepadtouchpadevent.h>
+#include <QtSDL/qsdljoystickaxisevent.h>
+#include <QtSDL/qsdljoystickstateevent.h>
+#include <QtSDL/sdleventmanager.h>
+
+namespace {
+
+class UserEvent: public QtSDL::QSDLEvent {
+public:
+    using QSDLEvent::QSDLEvent;
+};
+
+// The switch used by SDLEventManager before the factory table.
+QtSDL::QSDLEvent* switchWrap(const SDL_Event& event) {
+    auto type = static_cast<SDL_EventType>(event.type);
+
+    switch (event.type) {
+    case SDL_EVENT_GAMEPAD_ADDED:
+    case SDL_EVENT_GAMEPAD_REMOVED:
+    case SDL_EVENT_GAMEPAD_REMAPPED:
+    case SDL_EVENT_GAMEPAD_UPDATE_COMPLETE:
+    case SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED:
+        return new QtSDL::QSDLGamepadEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION:
+    case SDL_EVENT_GAMEPAD_TOUCHPAD_UP:
+        return new QtSDL::QSDLGamepadTouchpadEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        return new QtSDL::QSDLGamepadSensorEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+    case SDL_EVENT_GAMEPAD_BUTTON_UP:
+        return new QtSDL::QSDLGamepadButtonEvent(event, type);
+
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        return new QtSDL::QSDLGamepadAxisEvent(event, type);
+
+    default:
+        return new QtSDL::QSDLEvent(event, type);
+    }
+}
+
+SDL_Event makeEvent(Uint32 type) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = type;
+    return event;
+}
+}
+
+EventFactoryTest::EventFactoryTest() {
+
+}
+
+EventFactoryTest::~EventFactoryTest() {
+
+}
+
+void EventFactoryTest::test() {
+    testBuiltInTypes();
+    testUserTypes();
+}
+
+void EventFactoryTest::testBuiltInTypes() {
+    using QtSDL::QSDLEventFactory;
+    using QtSDL::SDLEventManager;
+
+    for (Uint32 type = SDL_EVENT_GAMEPAD_AXIS_MOTION; type <= SDL_EVENT_GAMEPAD_STEAM_HANDLE_UPDATED; ++type) {
+        const SDL_Event event = makeEvent(type);
+        QtSDL::QSDLEvent* fromTable = QSDLEventFactory::create(event);
+        QtSDL::QSDLEvent* fromSwitch = switchWrap(event);
+
+        QVERIFY(typeid(*fromTable) == typeid(*fromSwitch));
+        QCOMPARE(fromTable->sdlType(), static_cast<SDL_EventType>(type));
+
+        delete fromTable;
+        delete fromSwitch;
+    }
+
+    QCOMPARE(QSDLEventFactory::descriptor(SDL_EVENT_GAMEPAD_AXIS_MOTION).group,
+             static_cast<quint32>(SDLEventManager::GamepadAxis));
+    QCOMPARE(QSDLEventFactory::descriptor(SDL_EVENT_GAMEPAD_ADDED).validation, QSDLEventFactory::NoValidation);
+    QCOMPARE(QSDLEventFactory::descriptor(SDL_EVENT_GAMEPAD_BUTTON_UP).validation,
+             QSDLEventFactory::RequiresOpenedDevice);
+    QCOMPARE(QSDLEventFactory::descriptor(SDL_EVENT_KEY_DOWN).group,
+             static_cast<quint32>(SDLEventManager::OtherEvents));
+
+    QtSDL::QSDLEvent* joystickAxis = QSDLEventFactory::create(makeEvent(SDL_EVENT_JOYSTICK_AXIS_MOTION));
+    QVERIFY(dynamic_cast<QtSDL::QSDLJoystickAxisEvent*>(joystickAxis));
+    delete joystickAxis;
+
+    QCOMPARE(QSDLEventFactory::descriptor(SDL_EVENT_JOYSTICK_HAT_MOTION).group,
+             static_cast<quint32>(SDLEventManager::JoystickHat));
+    QCOMPARE(QSDLEventFactory::descriptor(SDL_EVENT_JOYSTICK_ADDED).validation, QSDLEventFactory::NoValidation);
+
+    QtSDL::JoystickState state;
+    state.setButton(70, true);
+    state.setButton(200, true);
+    QVERIFY(state.button(70));
+    QVERIFY(!state.button(71));
+    QVERIFY(!state.button(200));
+    state.setButton(70, false);
+    QCOMPARE(state.buttons[1], quint64(0));
+}
+
+void EventFactoryTest::testUserTypes() {
+    using QtSDL::QSDLEventFactory;
+
+    const Uint32 first = SDL_EVENT_USER + 0x100;
+    QVERIFY(!QSDLEventFactory::registerUserType<UserEvent>(SDL_EVENT_GAMEPAD_ADDED));
+    QVERIFY(QSDLEventFactory::registerUserType<UserEvent>(first, 2));
+    QVERIFY(!QSDLEventFactory::registerUserType<UserEvent>(first + 1));
+
+    QtSDL::QSDLEvent* event = QSDLEventFactory::create(makeEvent(first + 1));
+    QVERIFY(dynamic_cast<UserEvent*>(event));
+    delete event;
+
+    event = QSDLEventFactory::create(makeEvent(first + 2));
+    QVERIFY(!dynamic_cast<UserEvent*>(event));
+    delete event;
+
+    QSDLEventFactory::unregisterUserType(first);
+    event = QSDLEventFactory::create(makeEvent(first));
+    QVERIFY(!dynamic_cast<UserEvent*>(event));
+    delete event;
+}
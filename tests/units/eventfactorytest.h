@@ -0,0 +1,34 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef EVENTFACTORY_TEST_H
+#define EVENTFACTORY_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The EventFactoryTest class checks that the QSDLEventFactory table wraps events
+ * into the same classes as the switch it replaced.
+ */
+class EventFactoryTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    EventFactoryTest();
+    ~EventFactoryTest();
+
+    void test();
+
+private:
+    void testBuiltInTypes();
+    void testUserTypes();
+};
+
+#endif // EVENTFACTORY_TEST_H
@@ -0,0 +1,97 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "eventmetricstest.h"
+
+#include <QtSDL/qsdlevent.h>
+#include <QtSDL/sdleventmetrics.h>
+
+using QtSDL::SDLEventMetrics;
+
+EventMetricsTest::EventMetricsTest() {
+
+}
+
+EventMetricsTest::~EventMetricsTest() {
+
+}
+
+void EventMetricsTest::test() {
+    testHistogram();
+    testTypeCounts();
+    testDelivery();
+}
+
+void EventMetricsTest::testHistogram() {
+    SDLEventMetrics metrics;
+    for (Uint64 value = 1; value <= 100; ++value) {
+        metrics.recordPosted(SDL_EVENT_GAMEPAD_AXIS_MOTION, value);
+    }
+
+    auto histogram = metrics.snapshot().pollToPost;
+    QCOMPARE(histogram.count, quint64(100));
+    QCOMPARE(histogram.sum, quint64(5050));
+    QCOMPARE(histogram.max, quint64(100));
+    QCOMPARE(histogram.mean(), 50.5);
+
+    // The 50th value (50) lies in the bucket [32, 63], the largest one is limited by the maximum.
+    QCOMPARE(histogram.percentile(50), quint64(63));
+    QCOMPARE(histogram.percentile(100), quint64(100));
+    QCOMPARE(histogram.buckets[0], quint64(0));
+    QCOMPARE(histogram.buckets[1], quint64(1));
+
+    metrics.recordCycle(0);
+    QCOMPARE(metrics.snapshot().eventsPerCycle.buckets[0], quint64(1));
+
+    metrics.reset();
+    histogram = metrics.snapshot().pollToPost;
+    QCOMPARE(histogram.count, quint64(0));
+    QCOMPARE(histogram.percentile(99), quint64(0));
+}
+
+void EventMetricsTest::testTypeCounts() {
+    SDLEventMetrics metrics;
+    metrics.recordPosted(SDL_EVENT_GAMEPAD_BUTTON_DOWN, 0);
+    metrics.recordPosted(SDL_EVENT_GAMEPAD_BUTTON_DOWN, 0);
+    metrics.recordPosted(SDL_EVENT_USER + 5, 0);
+    metrics.recordPosted(0x7E00, 0);
+
+    const auto counts = metrics.snapshot().typeCounts;
+    QCOMPARE(counts.size(), qsizetype(3));
+    QCOMPARE(counts.value(SDL_EVENT_GAMEPAD_BUTTON_DOWN), quint64(2));
+    QCOMPARE(counts.value(SDL_EVENT_USER), quint64(1));
+    QCOMPARE(counts.value(SDL_EVENT_FIRST), quint64(1));
+
+    // Events that were not posted are counted apart from the posted types.
+    metrics.recordUnposted(4);
+    metrics.recordUnposted(0);
+    QCOMPARE(metrics.snapshot().unposted, quint64(4));
+    QCOMPARE(metrics.snapshot().typeCounts.size(), qsizetype(3));
+
+    metrics.reset();
+    QCOMPARE(metrics.snapshot().unposted, quint64(0));
+}
+
+void EventMetricsTest::testDelivery() {
+    auto metrics = std::make_shared<SDLEventMetrics>();
+    metrics->recordDelivered(1000, 10);
+    QCOMPARE(metrics->snapshot().postToDelivery.count, quint64(10));
+    QCOMPARE(metrics->snapshot().postToDelivery.sum, quint64(10000));
+
+    SDL_Event sdlEvent;
+    SDL_zero(sdlEvent);
+    sdlEvent.type = SDL_EVENT_GAMEPAD_BUTTON_UP;
+    sdlEvent.common.timestamp = SDL_GetTicksNS();
+
+    auto event = new QtSDL::QSDLEvent(sdlEvent, SDL_EVENT_GAMEPAD_BUTTON_UP);
+    event->markPosted(SDL_GetTicksNS(), metrics);
+    QVERIFY(event->postedTimestamp() >= event->sdlTimestamp());
+    delete event;
+
+    QCOMPARE(metrics->snapshot().postToDelivery.count, quint64(11));
+}
@@ -0,0 +1,34 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef EVENTMETRICS_TEST_H
+#define EVENTMETRICS_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The EventMetricsTest class checks the histograms and counters of SDLEventMetrics.
+ */
+class EventMetricsTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    EventMetricsTest();
+    ~EventMetricsTest();
+
+    void test();
+
+private:
+    void testHistogram();
+    void testTypeCounts();
+    void testDelivery();
+};
+
+#endif // EVENTMETRICS_TEST_H
@@ -0,0 +1,216 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "eventpooltest.h"
+
+#include <QtSDL/qsdleventpool.h>
+#include <QSet>
+#include <QThread>
+
+using QtSDL::QSDLEventPool;
+using QtSDL::QSDLEventPoolStats;
+
+EventPoolTest::EventPoolTest() {
+
+}
+
+EventPoolTest::~EventPoolTest() {
+
+}
+
+void EventPoolTest::test() {
+    // The pool is global, so every case starts from an empty shared stack and checks the counters relative to it.
+    testCrossThread();
+    testConcurrentRelease();
+    testLimits();
+}
+
+void EventPoolTest::testCrossThread() {
+    constexpr int count = 64;
+    const std::size_t size = QSDLEventPool::blockSize() / 2;
+
+    QSDLEventPool::trim();
+    QSDLEventPool::resetStats();
+    const QSDLEventPoolStats base = QSDLEventPool::stats();
+    const std::size_t oldMaxCached = QSDLEventPool::maxCached();
+    QSDLEventPool::setMaxCached(base.cached + count);
+
+    // The allocating thread has an empty free list and the shared stack is empty, so every block is new.
+    QList<void*> blocks;
+    runInThread([&blocks, size]() {
+        for (int i = 0; i < count; ++i) {
+            blocks.append(QSDLEventPool::allocate(size));
+        }
+    });
+
+    QSDLEventPoolStats stats = QSDLEventPool::stats();
+    QCOMPARE(stats.hits, quint64(0));
+    QCOMPARE(stats.misses, quint64(count));
+    QCOMPARE(stats.live, base.live + count);
+    QCOMPARE(stats.peakLive, base.live + count);
+
+    // Blocks released on another thread go to the shared stack.
+    for (void* block : blocks) {
+        QSDLEventPool::release(block, size);
+    }
+
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.live, base.live);
+    QCOMPARE(stats.cached, base.cached + count);
+
+    // A new allocating thread takes the whole shared stack and reuses every released block.
+    QList<void*> reused;
+    runInThread([&reused, size]() {
+        for (int i = 0; i < count; ++i) {
+            reused.append(QSDLEventPool::allocate(size));
+        }
+    });
+
+    QCOMPARE(QSet<void*>(reused.cbegin(), reused.cend()), QSet<void*>(blocks.cbegin(), blocks.cend()));
+
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.hits, quint64(count));
+    QCOMPARE(stats.misses, quint64(count));
+    QCOMPARE(stats.live, base.live + count);
+    QCOMPARE(stats.cached, base.cached);
+
+    for (void* block : reused) {
+        QSDLEventPool::release(block, size);
+    }
+
+    QCOMPARE(QSDLEventPool::stats().cached, base.cached + count);
+
+    // trim() frees the shared stack only.
+    QSDLEventPool::trim();
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.cached, base.cached);
+    QCOMPARE(stats.live, base.live);
+
+    QSDLEventPool::setMaxCached(oldMaxCached);
+}
+
+void EventPoolTest::testConcurrentRelease() {
+    constexpr int releasers = 4;
+    constexpr int perThread = 1000;
+    constexpr int count = releasers * perThread;
+    const std::size_t size = QSDLEventPool::blockSize();
+
+    QSDLEventPool::trim();
+    QSDLEventPool::resetStats();
+    const QSDLEventPoolStats base = QSDLEventPool::stats();
+    const std::size_t oldMaxCached = QSDLEventPool::maxCached();
+    QSDLEventPool::setMaxCached(base.cached + count);
+
+    QList<void*> blocks;
+    runInThread([&blocks, size]() {
+        for (int i = 0; i < count; ++i) {
+            blocks.append(QSDLEventPool::allocate(size));
+        }
+    });
+
+    QCOMPARE(QSDLEventPool::stats().live, base.live + count);
+
+    // Several threads push to the shared stack at the same time.
+    const QList<void*>& allocated = blocks;
+    QList<QThread*> threads;
+    for (int index = 0; index < releasers; ++index) {
+        threads.append(QThread::create([&allocated, index, size]() {
+            for (int i = index * perThread; i < (index + 1) * perThread; ++i) {
+                QSDLEventPool::release(allocated[i], size);
+            }
+        }));
+    }
+
+    for (QThread* thread : std::as_const(threads)) {
+        thread->start();
+    }
+
+    for (QThread* thread : std::as_const(threads)) {
+        QVERIFY(thread->wait(10000));
+        delete thread;
+    }
+
+    QSDLEventPoolStats stats = QSDLEventPool::stats();
+    QCOMPARE(stats.live, base.live);
+    QCOMPARE(stats.cached, base.cached + count);
+
+    // No block may be lost or handed out twice by the concurrent pushes.
+    QList<void*> reused;
+    runInThread([&reused, size]() {
+        for (int i = 0; i < count; ++i) {
+            reused.append(QSDLEventPool::allocate(size));
+        }
+    });
+
+    const QSet<void*> unique(reused.cbegin(), reused.cend());
+    QCOMPARE(unique.size(), qsizetype(count));
+    QCOMPARE(unique, QSet<void*>(blocks.cbegin(), blocks.cend()));
+
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.hits, quint64(count));
+    QCOMPARE(stats.misses, quint64(count));
+
+    for (void* block : reused) {
+        QSDLEventPool::release(block, size);
+    }
+
+    QSDLEventPool::trim();
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.live, base.live);
+    QCOMPARE(stats.cached, base.cached);
+
+    QSDLEventPool::setMaxCached(oldMaxCached);
+}
+
+void EventPoolTest::testLimits() {
+    const std::size_t size = QSDLEventPool::blockSize();
+
+    QSDLEventPool::trim();
+    QSDLEventPool::resetStats();
+    const QSDLEventPoolStats base = QSDLEventPool::stats();
+    const std::size_t oldMaxCached = QSDLEventPool::maxCached();
+
+    // Oversized blocks bypass the pool: they are always misses and are never cached.
+    void* large = nullptr;
+    runInThread([&large, size]() {
+        large = QSDLEventPool::allocate(size + 1);
+    });
+
+    QSDLEventPoolStats stats = QSDLEventPool::stats();
+    QCOMPARE(stats.misses, quint64(1));
+    QCOMPARE(stats.live, base.live + 1);
+
+    QSDLEventPool::release(large, size + 1);
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.live, base.live);
+    QCOMPARE(stats.cached, base.cached);
+
+    // A full pool returns released blocks to the global allocator.
+    QSDLEventPool::setMaxCached(base.cached);
+
+    void* block = nullptr;
+    runInThread([&block, size]() {
+        block = QSDLEventPool::allocate(size);
+    });
+
+    QCOMPARE(QSDLEventPool::stats().misses, quint64(2));
+
+    QSDLEventPool::release(block, size);
+    stats = QSDLEventPool::stats();
+    QCOMPARE(stats.live, base.live);
+    QCOMPARE(stats.cached, base.cached);
+
+    QSDLEventPool::setMaxCached(oldMaxCached);
+}
+
+void EventPoolTest::runInThread(const std::function<void()> &job) {
+    QThread* thread = QThread::create(job);
+    thread->start();
+    QVERIFY(thread->wait(10000));
+    delete thread;
+}
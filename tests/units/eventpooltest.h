@@ -0,0 +1,40 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef EVENTPOOL_TEST_H
+#define EVENTPOOL_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+#include <functional>
+
+/**
+ * @brief The EventPoolTest class checks the counters, the cross-thread reuse and the limits of QSDLEventPool.
+ */
+class EventPoolTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    EventPoolTest();
+    ~EventPoolTest();
+
+    void test();
+
+private:
+    void testCrossThread();
+    void testConcurrentRelease();
+    void testLimits();
+
+    /**
+     * @brief Runs @a job on a new thread and waits for it. A new thread starts with an empty local free list.
+     */
+    void runInThread(const std::function<void()>& job);
+};
+
+#endif // EVENTPOOL_TEST_H
@@ -0,0 +1,219 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "inputrecordertest.h"
+
+#include <QtSDL/inputrecorder.h>
+#include <QtSDL/inputreplay.h>
+#include <QTemporaryDir>
+#include <QtEndian>
+#include <cstring>
+
+using QtSDL::InputRecorder;
+using QtSDL::InputReplay;
+
+namespace {
+
+QList<SDL_Event> sampleEvents(Uint64 start) {
+    QList<SDL_Event> events;
+
+    SDL_Event axis;
+    SDL_zero(axis);
+    axis.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+    axis.gaxis.timestamp = start + 1000;
+    axis.gaxis.which = 7;
+    axis.gaxis.axis = SDL_GAMEPAD_AXIS_LEFTX;
+    axis.gaxis.value = -12345;
+    events.append(axis);
+
+    // Equal timestamps are stored as a zero delta.
+    SDL_Event button;
+    SDL_zero(button);
+    button.type = SDL_EVENT_GAMEPAD_BUTTON_DOWN;
+    button.gbutton.timestamp = start + 1000;
+    button.gbutton.which = 7;
+    button.gbutton.button = SDL_GAMEPAD_BUTTON_SOUTH;
+    button.gbutton.down = true;
+    events.append(button);
+
+    // A delta of several seconds needs a multi-byte LEB128 timestamp, and the sensor payload is not trimmed.
+    SDL_Event sensor;
+    SDL_zero(sensor);
+    sensor.type = SDL_EVENT_GAMEPAD_SENSOR_UPDATE;
+    sensor.gsensor.timestamp = start + 5000000000ULL;
+    sensor.gsensor.which = 7;
+    sensor.gsensor.sensor = SDL_SENSOR_GYRO;
+    sensor.gsensor.data[0] = 0.5f;
+    sensor.gsensor.data[1] = -1.0f;
+    sensor.gsensor.data[2] = 2.0f;
+    sensor.gsensor.sensor_timestamp = 123456789;
+    events.append(sensor);
+
+    return events;
+}
+}
+
+InputRecorderTest::InputRecorderTest() {
+
+}
+
+InputRecorderTest::~InputRecorderTest() {
+
+}
+
+void InputRecorderTest::test() {
+    testRoundTrip(InputRecorder::DeltaTimestamps);
+    testRoundTrip(InputRecorder::NoOptions);
+    testTruncated();
+    testPointerEvents();
+}
+
+void InputRecorderTest::testRoundTrip(quint16 options) {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("recording.qsdlrec");
+
+    InputRecorder recorder;
+    QVERIFY(recorder.open(path, InputRecorder::Options::fromInt(options)));
+
+    // The start timestamp of the header is the base of the first delta.
+    const Uint64 start = SDL_GetTicksNS();
+    const QList<SDL_Event> events = sampleEvents(start);
+    recorder.writeDevice(7, start);
+    for (const SDL_Event& event : events) {
+        recorder.writeEvent(event);
+    }
+    recorder.commit();
+    recorder.close();
+    QCOMPARE(recorder.recordedEvents(), quint64(events.size()));
+
+    QFile file(path);
+    QCOMPARE(quint64(file.size()), recorder.writtenBytes());
+    QVERIFY(file.size() > InputRecorder::HEADER_SIZE);
+
+    InputReplay replay;
+    QVERIFY(replay.open(path));
+    QCOMPARE(replay.options().toInt(), int(options));
+    QVERIFY(replay.startTimestamp() <= start);
+
+    SDL_Event event;
+    InputReplay::RecordedDevice device;
+    QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::Device);
+    QCOMPARE(device.id, SDL_JoystickID(7));
+
+    for (const SDL_Event& expected : events) {
+        QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::Event);
+        QCOMPARE(event.type, expected.type);
+        QCOMPARE(event.common.timestamp, expected.common.timestamp);
+        QVERIFY(!std::memcmp(reinterpret_cast<const char*>(&event) + InputRecorder::EVENT_HEADER_SIZE,
+                             reinterpret_cast<const char*>(&expected) + InputRecorder::EVENT_HEADER_SIZE,
+                             sizeof(SDL_Event) - InputRecorder::EVENT_HEADER_SIZE));
+    }
+
+    QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::End);
+    QVERIFY(!replay.isCorrupted());
+
+    // The records can be read again after a rewind.
+    replay.rewind();
+    QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::Device);
+}
+
+void InputRecorderTest::testTruncated() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("truncated.qsdlrec");
+
+    InputRecorder recorder;
+    QVERIFY(recorder.open(path));
+    const QList<SDL_Event> events = sampleEvents(SDL_GetTicksNS());
+    for (const SDL_Event& event : events) {
+        recorder.writeEvent(event);
+    }
+    recorder.close();
+
+    // The tail of the last record is lost, as if the application crashed while writing it.
+    QFile file(path);
+    QVERIFY(file.resize(file.size() - 3));
+
+    InputReplay replay;
+    QVERIFY(replay.open(path));
+
+    SDL_Event event;
+    InputReplay::RecordedDevice device;
+    for (qsizetype i = 0; i < events.size() - 1; ++i) {
+        QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::Event);
+        QCOMPARE(event.type, events[i].type);
+    }
+
+    QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::End);
+    QVERIFY(replay.isCorrupted());
+
+    // A file shorter than the header is not a recording.
+    replay.close();
+    QVERIFY(file.resize(InputRecorder::HEADER_SIZE - 1));
+    QVERIFY(!replay.open(path));
+}
+
+void InputRecorderTest::testPointerEvents() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("pointers.qsdlrec");
+
+    static char text[] = "stale";
+    SDL_Event textInput;
+    SDL_zero(textInput);
+    textInput.type = SDL_EVENT_TEXT_INPUT;
+    textInput.text.timestamp = SDL_GetTicksNS();
+    textInput.text.text = text;
+
+    SDL_Event drop;
+    SDL_zero(drop);
+    drop.type = SDL_EVENT_DROP_FILE;
+    drop.drop.data = text;
+
+    SDL_Event user;
+    SDL_zero(user);
+    user.type = SDL_EVENT_USER;
+    user.user.data1 = text;
+
+    // Events that carry pointers are rejected by the recorder.
+    InputRecorder recorder;
+    QVERIFY(recorder.open(path, InputRecorder::NoOptions));
+    QVERIFY(!recorder.writeEvent(textInput));
+    QVERIFY(!recorder.writeEvent(drop));
+    QVERIFY(!recorder.writeEvent(user));
+    QCOMPARE(recorder.recordedEvents(), quint64(0));
+    recorder.close();
+
+    // A text input record written by hand, with a pointer in its payload, is skipped by the replay.
+    const SDL_Event axis = sampleEvents(textInput.text.timestamp).first();
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::Append));
+    for (const SDL_Event& event : {textInput, axis}) {
+        const qsizetype payload = sizeof(SDL_Event) - InputRecorder::EVENT_HEADER_SIZE;
+        QByteArray record(1 + 8 + 4 + 1, '\0');
+        record[0] = static_cast<char>(InputRecorder::RecordKind::Event);
+        qToLittleEndian<quint64>(event.common.timestamp, record.data() + 1);
+        qToLittleEndian<quint32>(event.type, record.data() + 9);
+        record[13] = static_cast<char>(payload);
+        record.append(reinterpret_cast<const char*>(&event) + InputRecorder::EVENT_HEADER_SIZE, payload);
+        QCOMPARE(file.write(record), qint64(record.size()));
+    }
+    file.close();
+
+    InputReplay replay;
+    QVERIFY(replay.open(path));
+
+    SDL_Event event;
+    InputReplay::RecordedDevice device;
+    QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::Event);
+    QCOMPARE(event.type, Uint32(SDL_EVENT_GAMEPAD_AXIS_MOTION));
+    QCOMPARE(event.gaxis.value, axis.gaxis.value);
+    QCOMPARE(replay.next(event, device), InputRecorder::RecordKind::End);
+    QVERIFY(!replay.isCorrupted());
+}
@@ -0,0 +1,34 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef INPUTRECORDER_TEST_H
+#define INPUTRECORDER_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The InputRecorderTest class checks the binary format written by InputRecorder and read by InputReplay.
+ */
+class InputRecorderTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    InputRecorderTest();
+    ~InputRecorderTest();
+
+    void test();
+
+private:
+    void testRoundTrip(quint16 options);
+    void testTruncated();
+    void testPointerEvents();
+};
+
+#endif // INPUTRECORDER_TEST_H
@@ -0,0 +1,126 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "orientationfiltertest.h"
+
+#include <QtSDL/gamepadorientationfilter.h>
+#include <cmath>
+
+using QtSDL::GamepadOrientationFilter;
+using QtSDL::OrientationState;
+
+namespace {
+
+SDL_GamepadSensorEvent sensorEvent(SDL_SensorType sensor, Uint64 timestamp, float x, float y, float z) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = SDL_EVENT_GAMEPAD_SENSOR_UPDATE;
+    event.gsensor.timestamp = timestamp;
+    event.gsensor.sensor_timestamp = timestamp;
+    event.gsensor.which = 1;
+    event.gsensor.sensor = sensor;
+    event.gsensor.data[0] = x;
+    event.gsensor.data[1] = y;
+    event.gsensor.data[2] = z;
+    return event.gsensor;
+}
+}
+
+OrientationFilterTest::OrientationFilterTest() {
+
+}
+
+OrientationFilterTest::~OrientationFilterTest() {
+
+}
+
+void OrientationFilterTest::test() {
+    testMagnitudes();
+    testRotation();
+    testRestCalibration();
+}
+
+void OrientationFilterTest::testMagnitudes() {
+    // An odd size also covers the scalar tail of the SIMD loops.
+    const int count = 37;
+    QList<float> x, y, z;
+    for (int i = 0; i < count; ++i) {
+        x.append(std::sin(i * 0.7f) * 3.0f);
+        y.append(std::cos(i * 0.3f) * 9.8f);
+        z.append(i * 0.05f - 1.0f);
+    }
+
+    const std::array<float, 3> offset {0.1f, -0.2f, 0.3f};
+    QList<float> vectorized(count), scalar(count);
+    GamepadOrientationFilter::magnitudes(x.constData(), y.constData(), z.constData(), offset, vectorized.data(), count);
+    GamepadOrientationFilter::magnitudesScalar(x.constData(), y.constData(), z.constData(), offset, scalar.data(), count);
+
+    for (int i = 0; i < count; ++i) {
+        QVERIFY(std::abs(vectorized[i] - scalar[i]) < 1e-5f);
+    }
+}
+
+void OrientationFilterTest::testRotation() {
+    GamepadOrientationFilter filter;
+    const Uint64 step = SDL_MS_TO_NS(1);
+    const float speed = 1.5707963f;
+
+    // A quarter turn around the vertical axis does not change the gravity seen by the gamepad.
+    QVERIFY(filter.push(sensorEvent(SDL_SENSOR_ACCEL, 0, 0, GamepadOrientationFilter::GRAVITY, 0)));
+    for (int i = 0; i <= 1000; ++i) {
+        QVERIFY(filter.push(sensorEvent(SDL_SENSOR_GYRO, i * step, 0, speed, 0)));
+    }
+    QVERIFY(!filter.push(sensorEvent(SDL_SENSOR_GYRO_L, 0, 0, 0, 0)));
+
+    filter.process();
+    QVERIFY(filter.hasUpdates());
+
+    const QList<OrientationState> updates = filter.takeUpdates();
+    QCOMPARE(updates.size(), qsizetype(1));
+    const OrientationState& state = updates.first();
+    QCOMPARE(state.device, SDL_JoystickID(1));
+    QCOMPARE(state.timestamp, 1000 * step);
+    QVERIFY(std::abs(state.w - std::sqrt(0.5f)) < 1e-2f);
+    QVERIFY(std::abs(state.y - std::sqrt(0.5f)) < 1e-2f);
+    QVERIFY(std::abs(state.x) < 1e-2f);
+    QVERIFY(std::abs(state.z) < 1e-2f);
+    QVERIFY(!filter.hasUpdates());
+
+    filter.removeDevice(1);
+    QCOMPARE(filter.orientation(1).w, 1.0f);
+}
+
+void OrientationFilterTest::testRestCalibration() {
+    GamepadOrientationFilter filter;
+    const Uint64 step = SDL_MS_TO_NS(1);
+    const std::array<float, 3> bias {0.01f, -0.02f, 0.005f};
+
+    // A resting gamepad with a biased gyroscope, fed in batches of one frame.
+    for (int frame = 0; frame < 300; ++frame) {
+        for (int i = frame * 16; i < (frame + 1) * 16; ++i) {
+            filter.push(sensorEvent(SDL_SENSOR_ACCEL, i * step, 0, GamepadOrientationFilter::GRAVITY, 0));
+            filter.push(sensorEvent(SDL_SENSOR_GYRO, i * step, bias[0], bias[1], bias[2]));
+        }
+        filter.process();
+    }
+
+    const OrientationState state = filter.orientation(1);
+    QVERIFY(state.atRest);
+    QVERIFY(state.calibrated);
+    for (int axis = 0; axis < 3; ++axis) {
+        QVERIFY(std::abs(state.gyroBias[axis] - bias[axis]) < 1e-3f);
+    }
+
+    // The accelerometer and the calibration keep the resting gamepad level.
+    QVERIFY(std::abs(state.w) > 0.99f);
+
+    // Motion ends the rest period.
+    filter.push(sensorEvent(SDL_SENSOR_GYRO, 4800 * step, 1.0f, 0, 0));
+    filter.process();
+    QVERIFY(!filter.orientation(1).atRest);
+}
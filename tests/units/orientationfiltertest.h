@@ -0,0 +1,34 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef ORIENTATIONFILTER_TEST_H
+#define ORIENTATIONFILTER_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The OrientationFilterTest class checks the kernels, the integration and the bias calibration of GamepadOrientationFilter.
+ */
+class OrientationFilterTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    OrientationFilterTest();
+    ~OrientationFilterTest();
+
+    void test();
+
+private:
+    void testMagnitudes();
+    void testRotation();
+    void testRestCalibration();
+};
+
+#endif // ORIENTATIONFILTER_TEST_H
@@ -0,0 +1,97 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "spscqueuetest.h"
+
+#include <QtSDL/spscqueue.h>
+#include <QThread>
+
+using QtSDL::SPSCQueue;
+
+SPSCQueueTest::SPSCQueueTest() {
+
+}
+
+SPSCQueueTest::~SPSCQueueTest() {
+
+}
+
+void SPSCQueueTest::test() {
+    testSingleThread();
+    testProducerConsumer();
+}
+
+void SPSCQueueTest::testSingleThread() {
+    // The capacity is rounded up to a power of two.
+    SPSCQueue<int> queue(5);
+    QCOMPARE(queue.capacity(), qsizetype(8));
+    QVERIFY(queue.isEmpty());
+
+    int value = -1;
+    QVERIFY(!queue.pop(value));
+    QCOMPARE(value, -1);
+
+    // Several rounds move the indexes across the end of the ring buffer.
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            QVERIFY(queue.push(next++));
+        }
+
+        QCOMPARE(queue.size(), qsizetype(8));
+        QVERIFY(!queue.push(-1));
+
+        for (int i = 0; i < 3; ++i) {
+            QVERIFY(queue.pop(value));
+            QCOMPARE(value, expected++);
+        }
+
+        const qsizetype drained = queue.drain([&expected](const int& drainedValue) {
+            QCOMPARE(drainedValue, expected++);
+        });
+        QCOMPARE(drained, qsizetype(5));
+        QVERIFY(queue.isEmpty());
+        QVERIFY(!queue.pop(value));
+    }
+
+    QCOMPARE(queue.dropped(), quint64(5));
+}
+
+void SPSCQueueTest::testProducerConsumer() {
+    constexpr quint64 count = 200000;
+    SPSCQueue<quint64> queue(64);
+
+    // The producer retries full pushes, so every value must arrive exactly once and in order.
+    QThread* producer = QThread::create([&queue]() {
+        for (quint64 value = 0; value < count; ++value) {
+            while (!queue.push(value)) {
+                QThread::yieldCurrentThread();
+            }
+        }
+    });
+    producer->start();
+
+    quint64 expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        quint64 value = 0;
+        if (queue.pop(value)) {
+            ordered = ordered && value == expected;
+            ++expected;
+        } else {
+            QThread::yieldCurrentThread();
+        }
+    }
+
+    QVERIFY(producer->wait(10000));
+    delete producer;
+
+    QVERIFY(ordered);
+    QVERIFY(queue.isEmpty());
+}
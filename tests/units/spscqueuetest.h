@@ -0,0 +1,33 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef SPSCQUEUE_TEST_H
+#define SPSCQUEUE_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The SPSCQueueTest class checks the capacity, the wraparound and the thread handover of SPSCQueue.
+ */
+class SPSCQueueTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    SPSCQueueTest();
+    ~SPSCQueueTest();
+
+    void test();
+
+private:
+    void testSingleThread();
+    void testProducerConsumer();
+};
+
+#endif // SPSCQUEUE_TEST_H
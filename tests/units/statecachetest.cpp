@@ -0,0 +1,169 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "statecachetest.h"
+
+#include <QtSDL/gamepadstatecache.h>
+#include <QThread>
+#include <atomic>
+
+using QtSDL::GamepadState;
+using QtSDL::GamepadStateCache;
+
+namespace {
+
+constexpr SDL_JoystickID DEVICE = 1;
+
+void setAxis(GamepadStateCache& cache, SDL_JoystickID device, int axis, Sint16 value, Uint64 timestamp) {
+    SDL_Event event {};
+    event.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+    event.gaxis.timestamp = timestamp;
+    event.gaxis.which = device;
+    event.gaxis.axis = static_cast<Uint8>(axis);
+    event.gaxis.value = value;
+    cache.update(event);
+}
+
+void setButton(GamepadStateCache& cache, SDL_JoystickID device, SDL_GamepadButton button, bool down, Uint64 timestamp) {
+    SDL_Event event {};
+    event.type = (down)? SDL_EVENT_GAMEPAD_BUTTON_DOWN: SDL_EVENT_GAMEPAD_BUTTON_UP;
+    event.gbutton.timestamp = timestamp;
+    event.gbutton.which = device;
+    event.gbutton.button = static_cast<Uint8>(button);
+    event.gbutton.down = down;
+    cache.update(event);
+}
+
+/**
+ * @brief Checks that every field of @a state was written by the same iteration of the writer.
+ */
+bool isConsistent(const GamepadState& state) {
+    const Sint16 value = state.axes[0];
+    for (Sint16 axis : state.axes) {
+        if (axis != value) {
+            return false;
+        }
+    }
+
+    return state.timestamp == Uint64(value) &&
+           state.isPressed(SDL_GAMEPAD_BUTTON_SOUTH) == bool(value & 1) &&
+           state.isPressed(SDL_GAMEPAD_BUTTON_EAST) != bool(value & 1);
+}
+}
+
+StateCacheTest::StateCacheTest() {
+
+}
+
+StateCacheTest::~StateCacheTest() {
+
+}
+
+void StateCacheTest::test() {
+    testDevices();
+    testConcurrentSnapshots();
+}
+
+void StateCacheTest::testDevices() {
+    GamepadStateCache cache;
+    GamepadState state;
+
+    QVERIFY(!cache.snapshot(DEVICE, state));
+    QVERIFY(!cache.snapshot(0, state));
+    QVERIFY(cache.devices().isEmpty());
+
+    QVERIFY(cache.addDevice(DEVICE, nullptr));
+    QVERIFY(cache.snapshot(DEVICE, state));
+    QCOMPARE(state.device, DEVICE);
+    QCOMPARE(state.axis(SDL_GAMEPAD_AXIS_LEFTX), Sint16(0));
+    QCOMPARE(cache.devices(), QList<SDL_JoystickID>{DEVICE});
+
+    // Changes are invisible to the readers until publish().
+    setAxis(cache, DEVICE, SDL_GAMEPAD_AXIS_LEFTX, 1000, 10);
+    setButton(cache, DEVICE, SDL_GAMEPAD_BUTTON_SOUTH, true, 11);
+    QVERIFY(cache.snapshot(DEVICE, state));
+    QCOMPARE(state.axis(SDL_GAMEPAD_AXIS_LEFTX), Sint16(0));
+
+    cache.publish();
+    QVERIFY(cache.snapshot(DEVICE, state));
+    QCOMPARE(state.axis(SDL_GAMEPAD_AXIS_LEFTX), Sint16(1000));
+    QVERIFY(state.isPressed(SDL_GAMEPAD_BUTTON_SOUTH));
+    QCOMPARE(state.timestamp, Uint64(11));
+
+    // Events of untracked gamepads are ignored.
+    setAxis(cache, DEVICE + 1, SDL_GAMEPAD_AXIS_LEFTX, 2000, 12);
+    cache.publish();
+    QVERIFY(!cache.snapshot(DEVICE + 1, state));
+
+    cache.removeDevice(DEVICE);
+    QVERIFY(!cache.snapshot(DEVICE, state));
+    QVERIFY(cache.devices().isEmpty());
+
+    // Every slot may be used, and the cache refuses more devices than it has slots.
+    for (int device = 1; device <= GamepadStateCache::MAX_DEVICES; ++device) {
+        QVERIFY(cache.addDevice(device, nullptr));
+    }
+
+    QVERIFY(!cache.addDevice(GamepadStateCache::MAX_DEVICES + 1, nullptr));
+    QCOMPARE(cache.devices().size(), qsizetype(GamepadStateCache::MAX_DEVICES));
+
+    cache.clear();
+    QVERIFY(cache.devices().isEmpty());
+}
+
+void StateCacheTest::testConcurrentSnapshots() {
+    constexpr int iterations = 100000;
+
+    GamepadStateCache cache;
+    QVERIFY(cache.addDevice(DEVICE, nullptr));
+
+    // Each iteration writes the same value to every axis, the timestamp and two opposite buttons,
+    // so a snapshot that mixes two iterations is easy to detect.
+    std::atomic<bool> finished {false};
+    QThread* writer = QThread::create([&cache, &finished]() {
+        for (int iteration = 1; iteration <= iterations; ++iteration) {
+            const Sint16 value = static_cast<Sint16>(iteration % 32767 + 1);
+            for (int axis = 0; axis < SDL_GAMEPAD_AXIS_COUNT; ++axis) {
+                setAxis(cache, DEVICE, axis, value, Uint64(value));
+            }
+
+            setButton(cache, DEVICE, SDL_GAMEPAD_BUTTON_SOUTH, value & 1, Uint64(value));
+            setButton(cache, DEVICE, SDL_GAMEPAD_BUTTON_EAST, !(value & 1), Uint64(value));
+            cache.publish();
+        }
+
+        finished.store(true, std::memory_order_release);
+    });
+    writer->start();
+
+    quint64 reads = 0;
+    quint64 torn = 0;
+    GamepadState state;
+    while (!finished.load(std::memory_order_acquire)) {
+        if (!cache.snapshot(DEVICE, state) || state.device != DEVICE) {
+            ++torn;
+        } else if (state.timestamp && !isConsistent(state)) {
+            // The timestamp is 0 only before the first publish().
+            ++torn;
+        }
+
+        ++reads;
+    }
+
+    QVERIFY(writer->wait(10000));
+    delete writer;
+
+    QVERIFY2(!torn, qPrintable(QString("%0 of %1 snapshots were torn").arg(torn).arg(reads)));
+
+    QVERIFY(cache.snapshot(DEVICE, state));
+    QVERIFY(isConsistent(state));
+    QCOMPARE(state.axes[0], Sint16(iterations % 32767 + 1));
+
+    cache.removeDevice(DEVICE);
+    QVERIFY(!cache.snapshot(DEVICE, state));
+}
@@ -0,0 +1,33 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef STATECACHE_TEST_H
+#define STATECACHE_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The StateCacheTest class checks the device tracking and the seqlock snapshots of GamepadStateCache.
+ */
+class StateCacheTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    StateCacheTest();
+    ~StateCacheTest();
+
+    void test();
+
+private:
+    void testDevices();
+    void testConcurrentSnapshots();
+};
+
+#endif // STATECACHE_TEST_H
@@ -0,0 +1,99 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#include "touchpadtrackertest.h"
+
+#include <QtSDL/gamepadtouchpadtracker.h>
+
+using QtSDL::GamepadTouchpadTracker;
+using QtSDL::TouchpadTrajectory;
+
+namespace {
+
+SDL_Event touchEvent(Uint32 type, Uint64 timestamp, float x, float y) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = type;
+    event.gtouchpad.timestamp = timestamp;
+    event.gtouchpad.which = 1;
+    event.gtouchpad.x = x;
+    event.gtouchpad.y = y;
+    event.gtouchpad.pressure = 1.0f;
+    return event;
+}
+}
+
+TouchpadTrackerTest::TouchpadTrackerTest() {
+
+}
+
+TouchpadTrackerTest::~TouchpadTrackerTest() {
+
+}
+
+void TouchpadTrackerTest::test() {
+    testSwipe();
+    testTap();
+}
+
+void TouchpadTrackerTest::testSwipe() {
+    GamepadTouchpadTracker tracker;
+    const Uint64 step = SDL_MS_TO_NS(4);
+
+    QVERIFY(tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN, 0, 0.1f, 0.5f)));
+    for (int i = 1; i <= 20; ++i) {
+        QVERIFY(tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION, i * step, 0.1f + i * 0.02f, 0.5f)));
+    }
+
+    // The whole swipe of the cycle is one trajectory.
+    QList<TouchpadTrajectory> trajectories = tracker.takeTrajectories();
+    QCOMPARE(trajectories.size(), qsizetype(1));
+    const TouchpadTrajectory& swipe = trajectories.first();
+    QVERIFY(swipe.began);
+    QVERIFY(!swipe.ended);
+    QCOMPARE(swipe.points.size(), qsizetype(21));
+    QVERIFY(swipe.velocityX > 4.0f && swipe.velocityX < 5.01f);
+    QVERIFY(std::abs(swipe.velocityY) < 1e-3f);
+    QVERIFY(!tracker.hasPending());
+
+    // Jitter below the minimal distance collapses into a single point with the latest sample.
+    const float end = 0.1f + 20 * 0.02f;
+    for (int i = 21; i <= 25; ++i) {
+        tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_MOTION, i * step, end + (i % 2) * 0.0005f, 0.5f));
+    }
+    tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_UP, 26 * step, end, 0.5f));
+
+    trajectories = tracker.takeTrajectories();
+    QCOMPARE(trajectories.size(), qsizetype(1));
+    QVERIFY(!trajectories.first().began);
+    QVERIFY(trajectories.first().ended);
+    QCOMPARE(trajectories.first().points.size(), qsizetype(1));
+    QCOMPARE(trajectories.first().points.first().timestamp, 26 * step);
+}
+
+void TouchpadTrackerTest::testTap() {
+    GamepadTouchpadTracker tracker;
+    tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN, 0, 0.3f, 0.3f));
+    tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_UP, SDL_MS_TO_NS(8), 0.3f, 0.3f));
+
+    QList<TouchpadTrajectory> trajectories = tracker.takeTrajectories();
+    QCOMPARE(trajectories.size(), qsizetype(1));
+    QVERIFY(trajectories.first().began);
+    QVERIFY(trajectories.first().ended);
+    QCOMPARE(trajectories.first().points.size(), qsizetype(2));
+
+    // A disconnection ends the trajectories of the gamepad.
+    tracker.process(touchEvent(SDL_EVENT_GAMEPAD_TOUCHPAD_DOWN, SDL_MS_TO_NS(10), 0.5f, 0.5f));
+    tracker.takeTrajectories();
+    tracker.removeDevice(1, SDL_MS_TO_NS(20));
+
+    trajectories = tracker.takeTrajectories();
+    QCOMPARE(trajectories.size(), qsizetype(1));
+    QVERIFY(trajectories.first().ended);
+    QVERIFY(!tracker.process(touchEvent(SDL_EVENT_GAMEPAD_BUTTON_DOWN, 0, 0, 0)));
+}
@@ -0,0 +1,33 @@
+//#
+//# Copyright (C) 2025-2025 QuasarApp.
+//# Distributed under the GPLv3 software license, see the accompanying
+//# Everyone is permitted to copy and distribute verbatim copies
+//# of this license document, but changing it is not allowed.
+//#
+
+
+#ifndef TOUCHPADTRACKER_TEST_H
+#define TOUCHPADTRACKER_TEST_H
+
+#include <testcore/itest.h>
+#include "testcore/testutils.h"
+
+#include <QtTest>
+
+/**
+ * @brief The TouchpadTrackerTest class checks the trajectories, markers and velocities of GamepadTouchpadTracker.
+ */
+class TouchpadTrackerTest: public testcore::ITest, protected testcore::TestUtils
+{
+public:
+    TouchpadTrackerTest();
+    ~TouchpadTrackerTest();
+
+    void test();
+
+private:
+    void testSwipe();
+    void testTap();
+};
+
+#endif // TOUCHPADTRACKER_TEST_H